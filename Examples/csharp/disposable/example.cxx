@@ -0,0 +1,11 @@
+/* File : example.cxx */
+
+#include "example.h"
+
+double massOf(const Particle *particle) {
+  return particle->mass;
+}
+
+double lightMassOf(const LightParticle *particle) {
+  return particle->mass;
+}
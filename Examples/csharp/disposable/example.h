@@ -0,0 +1,25 @@
+/* File : example.h */
+
+class Particle {
+public:
+  Particle(double mass = 1.0) : mass(mass) { }
+  double mass;
+};
+
+class LightParticle {
+public:
+  LightParticle(double mass = 1.0) : mass(mass) { }
+  double mass;
+};
+
+class Emitter {
+public:
+  Particle *get(int i) { return &particles[i % 16]; }
+  LightParticle *getLight(int i) { return &lightParticles[i % 16]; }
+private:
+  Particle particles[16];
+  LightParticle lightParticles[16];
+};
+
+double massOf(const Particle *particle);
+double lightMassOf(const LightParticle *particle);
@@ -0,0 +1,16 @@
+/* File : example.i */
+%module example
+
+%include <disposable.i>
+
+/* LightParticle proxies have no finalizer and must be disposed */
+%cs_disposable(LightParticle)
+
+/* Borrowed LightParticle pointers are passed as LightParticle.Handle structs */
+%apply SWIGTYPE *HANDLE { LightParticle *getLight, const LightParticle *particle }
+
+%{
+#include "example.h"
+%}
+
+%include "example.h"
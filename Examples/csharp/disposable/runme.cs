@@ -0,0 +1,76 @@
+// This example compares the cost of the default proxy classes, which have a
+// finalizer, with the finalizer-free proxy classes generated by %cs_disposable,
+// by creating and disposing a million objects of each.
+
+using System;
+using System.Diagnostics;
+
+public class runme
+{
+  const int N = 1000000;
+
+  static void Main()
+  {
+    // Warm up the JIT and the native library
+    Run(1000);
+
+    Console.WriteLine("Creating and disposing {0} objects:", N);
+    Run(N);
+  }
+
+  static void Run(int n)
+  {
+    bool print = n == N;
+    double sum = 0;
+
+    // Default proxy classes, finalizer suppressed by Dispose()
+    Stopwatch watch = Stopwatch.StartNew();
+    for (int i = 0; i < n; i++) {
+      using (Particle p = new Particle(i)) {
+        sum += p.mass;
+      }
+    }
+    Report(print, "Particle with Dispose", watch);
+
+    // Default proxy classes left to the finalizer
+    watch = Stopwatch.StartNew();
+    for (int i = 0; i < n; i++) {
+      Particle p = new Particle(i);
+      sum += p.mass;
+    }
+    GC.Collect();
+    GC.WaitForPendingFinalizers();
+    Report(print, "Particle with finalizer", watch);
+
+    // Finalizer-free proxy classes
+    watch = Stopwatch.StartNew();
+    for (int i = 0; i < n; i++) {
+      using (LightParticle p = new LightParticle(i)) {
+        sum += p.mass;
+      }
+    }
+    Report(print, "LightParticle with Dispose", watch);
+
+    // Borrowed references as proxy classes and as Handle structs
+    using (Emitter emitter = new Emitter()) {
+      watch = Stopwatch.StartNew();
+      for (int i = 0; i < n; i++)
+        sum += example.massOf(emitter.get(i));
+      Report(print, "Particle borrowed", watch);
+
+      watch = Stopwatch.StartNew();
+      for (int i = 0; i < n; i++)
+        sum += example.lightMassOf(emitter.getLight(i));
+      Report(print, "LightParticle.Handle borrowed", watch);
+    }
+
+    if (sum < 0)
+      Console.WriteLine(sum);
+  }
+
+  static void Report(bool print, string what, Stopwatch watch)
+  {
+    if (print)
+      Console.WriteLine("  {0,-30} {1,6} ms", what, watch.ElapsedMilliseconds);
+  }
+}
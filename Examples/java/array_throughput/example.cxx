@@ -0,0 +1,15 @@
+/* File : example.cxx */
+
+#include "example.h"
+
+double sum(const double *values, int n) {
+  double s = 0;
+  for (int i = 0; i < n; ++i)
+    s += values[i];
+  return s;
+}
+
+void scale(double *values, int n, double factor) {
+  for (int i = 0; i < n; ++i)
+    values[i] *= factor;
+}
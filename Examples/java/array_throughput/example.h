@@ -0,0 +1,5 @@
+/* File : example.h */
+
+/* The same functions wrapped with copying, critical and direct buffer typemaps */
+double sum(const double *values, int n);
+void scale(double *values, int n, double factor);
@@ -0,0 +1,41 @@
+/* File : example.i */
+%module example
+
+%{
+#include "example.h"
+%}
+
+%include <typemaps.i>
+%include <various.i>
+%include <arrays_java.i>
+
+/* Java arrays copied in and out with Get/Release<Type>ArrayElements */
+%rename(sumCopy) sum_copy;
+%rename(scaleCopy) scale_copy;
+%apply double[] { double *copied };
+%apply const double[] { const double *copied };
+
+/* Java arrays accessed in place */
+%rename(sumCritical) sum_critical;
+%rename(scaleCritical) scale_critical;
+%apply double *CRITICAL { double *pinned };
+%apply const double *CRITICAL { const double *pinned };
+
+/* Direct java.nio.DoubleBuffer */
+%rename(sumBuffer) sum_buffer;
+%rename(scaleBuffer) scale_buffer;
+%apply double *NIOBUFFER { double *direct };
+%apply const double *NIOBUFFER { const double *direct };
+
+%ignore sum;
+%ignore scale;
+%include "example.h"
+
+%inline %{
+double sum_copy(const double *copied, int n) { return sum(copied, n); }
+void scale_copy(double *copied, int n, double factor) { scale(copied, n, factor); }
+double sum_critical(const double *pinned, int n) { return sum(pinned, n); }
+void scale_critical(double *pinned, int n, double factor) { scale(pinned, n, factor); }
+double sum_buffer(const double *direct, int n) { return sum(direct, n); }
+void scale_buffer(double *direct, int n, double factor) { scale(direct, n, factor); }
+%}
@@ -0,0 +1,50 @@
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+
+public class runme {
+  static {
+    try {
+        System.loadLibrary("example");
+    } catch (UnsatisfiedLinkError e) {
+      System.err.println("Native code library failed to load. See the chapter on Dynamic Linking Problems in the SWIG Java documentation for help.\n" + e);
+      System.exit(1);
+    }
+  }
+
+  interface Call {
+    void run();
+  }
+
+  static void measure(String name, int size, int calls, Call call) {
+    for (int i = 0; i < calls / 10; ++i)
+      call.run();
+    long start = System.nanoTime();
+    for (int i = 0; i < calls; ++i)
+      call.run();
+    double seconds = (System.nanoTime() - start) * 1e-9;
+    System.out.println("  " + name + ": " + (long)(8.0 * size * calls / seconds / 1e6) + " MB/s");
+  }
+
+  public static void main(String argv[]) {
+    for (int size = 1000; size <= 1000000; size *= 1000) {
+      final int n = size;
+      final int calls = 100000000 / size;
+      final double[] array = new double[n];
+      final DoubleBuffer buffer = ByteBuffer.allocateDirect(8 * n).order(ByteOrder.nativeOrder()).asDoubleBuffer();
+      java.util.Arrays.fill(array, 1.0);
+      for (int i = 0; i < n; ++i)
+        buffer.put(i, 1.0);
+
+      System.out.println(n + " doubles, sum");
+      measure("copy    ", n, calls, new Call() { public void run() { example.sumCopy(array, n); } });
+      measure("critical", n, calls, new Call() { public void run() { example.sumCritical(array, n); } });
+      measure("buffer  ", n, calls, new Call() { public void run() { example.sumBuffer(buffer, n); } });
+
+      System.out.println(n + " doubles, scale");
+      measure("copy    ", n, calls, new Call() { public void run() { example.scaleCopy(array, n, 1.0); } });
+      measure("critical", n, calls, new Call() { public void run() { example.scaleCritical(array, n, 1.0); } });
+      measure("buffer  ", n, calls, new Call() { public void run() { example.scaleBuffer(buffer, n, 1.0); } });
+    }
+  }
+}
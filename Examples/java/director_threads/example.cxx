@@ -0,0 +1,41 @@
+/* File : example.cxx */
+
+#include "example.h"
+#include <pthread.h>
+#include <sys/time.h>
+
+struct Work {
+  Callback *cb;
+  int ncalls;
+  int sum;
+};
+
+static void *work(void *arg) {
+  Work *w = static_cast<Work *>(arg);
+  for (int i = 0; i < w->ncalls; ++i)
+    w->sum += w->cb->handle(i);
+  return 0;
+}
+
+static double now() {
+  struct timeval tv;
+  gettimeofday(&tv, 0);
+  return tv.tv_sec + tv.tv_usec * 1e-6;
+}
+
+double callFromThreads(Callback *cb, int nthreads, int ncalls) {
+  pthread_t threads[64];
+  Work work_items[64];
+  if (nthreads > 64)
+    nthreads = 64;
+  double start = now();
+  for (int i = 0; i < nthreads; ++i) {
+    work_items[i].cb = cb;
+    work_items[i].ncalls = ncalls;
+    work_items[i].sum = 0;
+    pthread_create(&threads[i], 0, work, &work_items[i]);
+  }
+  for (int i = 0; i < nthreads; ++i)
+    pthread_join(threads[i], 0);
+  return now() - start;
+}
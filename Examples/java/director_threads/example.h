@@ -0,0 +1,11 @@
+/* File : example.h */
+
+class Callback {
+public:
+  virtual ~Callback() {}
+  virtual int handle(int value) { return value; }
+};
+
+/* Call cb->handle() ncalls times from each of nthreads native threads,
+   returns the elapsed time in seconds */
+double callFromThreads(Callback *cb, int nthreads, int ncalls);
@@ -0,0 +1,16 @@
+/* File : example.i */
+%module(directors="1") example
+
+/* Keep the native threads attached to the JVM between upcalls,
+   remove to compare with attaching and detaching around each upcall */
+%begin %{
+#define SWIG_JAVA_CACHE_JNIENV
+%}
+
+%{
+#include "example.h"
+%}
+
+%feature("director") Callback;
+
+%include "example.h"
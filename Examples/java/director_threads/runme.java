@@ -0,0 +1,36 @@
+public class runme
+{
+  static {
+    try {
+        System.loadLibrary("example");
+    } catch (UnsatisfiedLinkError e) {
+      System.err.println("Native code library failed to load. See the chapter on Dynamic Linking Problems in the SWIG Java documentation for help.\n" + e);
+      System.exit(1);
+    }
+  }
+
+  public static void main(String[] args)
+  {
+    Callback callback = new JavaCallback();
+    int ncalls = 100000;
+
+    for (int nthreads = 1; nthreads <= 4; nthreads *= 2) {
+      double seconds = example.callFromThreads(callback, nthreads, ncalls);
+      System.out.println(nthreads + " native thread(s): " + (long)(nthreads * ncalls / seconds) + " upcalls per second");
+    }
+    callback.delete();
+  }
+}
+
+class JavaCallback extends Callback
+{
+  public JavaCallback()
+  {
+    super();
+  }
+
+  public int handle(int value)
+  {
+    return value + 1;
+  }
+}
@@ -0,0 +1,17 @@
+/* File : example.i */
+%module swigexample
+
+%inline %{
+#include <iostream>
+
+/* Log like a control loop would, one short line per cycle */
+void log_lines(int n) {
+  for (int i = 0; i < n; ++i)
+    std::cout << "cycle " << i << ": state = " << 0.5 * i << '\n';
+}
+
+void log_lines_endl(int n) {
+  for (int i = 0; i < n; ++i)
+    std::cout << "cycle " << i << ": state = " << 0.5 * i << std::endl;
+}
+%}
@@ -0,0 +1,14 @@
+% file: runme.m
+% Throughput of std::cout redirected to the MATLAB command window (-redirectoutput)
+
+n = 100000;
+
+tic;
+evalc('swigexample.log_lines(n)');
+t = toc;
+disp(sprintf('log_lines: %d lines in %f seconds, %.0f lines per second', n, t, n/t))
+
+tic;
+evalc('swigexample.log_lines_endl(n)');
+t = toc;
+disp(sprintf('log_lines_endl: %d lines in %f seconds, %.0f lines per second', n, t, n/t))
@@ -0,0 +1,34 @@
+/* Overloaded functions with 2, 10 and 30 candidates, called with the
+   arguments of the last one, so that the time is spent in the typechecks */
+
+%define %candidates(N)
+%inline %{
+struct C##N { int value() const { return N; } };
+int over10(C##N *) { return N; }
+int over30(C##N *) { return N; }
+%}
+%enddef
+
+%candidates(0) %candidates(1) %candidates(2) %candidates(3) %candidates(4)
+%candidates(5) %candidates(6) %candidates(7) %candidates(8) %candidates(9)
+
+%define %more_candidates(N)
+%inline %{
+struct C##N { int value() const { return N; } };
+int over30(C##N *) { return N; }
+%}
+%enddef
+
+%more_candidates(10) %more_candidates(11) %more_candidates(12) %more_candidates(13) %more_candidates(14)
+%more_candidates(15) %more_candidates(16) %more_candidates(17) %more_candidates(18) %more_candidates(19)
+%more_candidates(20) %more_candidates(21) %more_candidates(22) %more_candidates(23) %more_candidates(24)
+%more_candidates(25) %more_candidates(26) %more_candidates(27) %more_candidates(28) %more_candidates(29)
+
+%inline %{
+int over2(int a) { return a; }
+int over2(double a) { return (int)a; }
+int mixed(int a, const char *) { return a; }
+int mixed(double a, const char *) { return (int)a; }
+int mixed(C0 *, int a) { return a; }
+int mixed(C9 *, double a) { return (int)a; }
+%}
@@ -0,0 +1,13 @@
+import sys
+import timeit
+sys.path.append('..')
+import harness
+
+
+def proc(mod):
+    setup = 'import %s as mod; c9 = mod.C9(); c29 = mod.C29()' % mod.__name__
+    for stmt in ['mod.over2(1.5)', 'mod.over10(c9)', 'mod.over30(c29)', 'mod.mixed(c9, 1.5)']:
+        t = timeit.Timer(stmt, setup).timeit(1000000)
+        print("  %-20s %f seconds" % (stmt, t))
+
+harness.run(proc, ['Simple_baseline', 'Simple_optimized', 'Simple_dispatchcache', 'Simple_builtin', 'Simple_builtin_dispatchcache'])
@@ -0,0 +1,21 @@
+/* Small functions, so that the time is spent passing the arguments */
+
+%feature("kwargs") kwfunc;
+
+%inline %{
+int func0() { return 0; }
+int func1(int a) { return a; }
+int func2(int a, int b) { return a + b; }
+int func3(int a, int b, int c) { return a + b + c; }
+int kwfunc(int a, int b = 0) { return a + b; }
+int over(int a) { return a; }
+int over(int a, int b) { return a + b; }
+
+class MyClass {
+public:
+    MyClass () {}
+    ~MyClass () {}
+    int get() const { return 0; }
+    int add(int a, int b) const { return a + b; }
+};
+%}
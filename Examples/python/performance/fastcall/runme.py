@@ -0,0 +1,14 @@
+import sys
+import timeit
+sys.path.append('..')
+import harness
+
+
+def proc(mod):
+    setup = 'import %s as mod; x = mod.MyClass()' % mod.__name__
+    for stmt in ['mod.func0()', 'mod.func1(1)', 'mod.func2(1, 2)', 'mod.func3(1, 2, 3)',
+                 'mod.kwfunc(1, b=2)', 'mod.over(1, 2)', 'x.get()', 'x.add(1, 2)']:
+        t = timeit.Timer(stmt, setup).timeit(1000000)
+        print("  %-20s %f seconds" % (stmt, t))
+
+harness.run(proc, ['Simple_baseline', 'Simple_optimized', 'Simple_fastcall', 'Simple_builtin', 'Simple_builtin_fastcall'])
@@ -0,0 +1,14 @@
+%inline %{
+class MyClass {
+public:
+    MyClass () {}
+    ~MyClass () {}
+    int get () const { return 0; }
+};
+
+class Derived : public MyClass {
+};
+
+int take (const MyClass &) { return 0; }
+int take2 (const MyClass &, const MyClass &) { return 0; }
+%}
@@ -0,0 +1,14 @@
+import sys
+import timeit
+sys.path.append('..')
+import harness
+
+
+def proc(mod):
+    # Each call looks up 'this' of its proxy arguments
+    setup = 'import %s as mod; x = mod.MyClass(); d = mod.Derived()' % mod.__name__
+    for stmt in ['x.get()', 'mod.take(x)', 'mod.take(d)', 'mod.take2(x, d)']:
+        t = timeit.Timer(stmt, setup).timeit(1000000)
+        print("  %-20s %f seconds" % (stmt, t))
+
+harness.run(proc, ['Simple_baseline', 'Simple_optimized', 'Simple_fastthis', 'Simple_builtin'])
@@ -1,32 +1,36 @@
 import sys
 import time
-import imp
 from subprocess import *
 
+try:
+    clock = time.perf_counter
+except AttributeError:
+    clock = time.clock
 
-def run(proc):
 
+def load(name):
     try:
-        mod = imp.find_module(sys.argv[1])
-        mod = imp.load_module(sys.argv[1], *mod)
+        import importlib
+        return importlib.import_module(name)
+    except ImportError:
+        import imp
+        mod = imp.find_module(name)
+        return imp.load_module(name, *mod)
 
-        t1 = time.clock()
+
+def run(proc, names=['Simple_baseline', 'Simple_optimized', 'Simple_builtin']):
+
+    try:
+        mod = load(sys.argv[1])
+
+        t1 = clock()
         proc(mod)
-        t2 = time.clock()
-        print "%s took %f seconds" % (mod.__name__, t2 - t1)
+        t2 = clock()
+        print("%s took %f seconds" % (mod.__name__, t2 - t1))
 
     except IndexError:
-        proc = Popen(
-            [sys.executable, 'runme.py', 'Simple_baseline'], stdout=PIPE)
-        (stdout, stderr) = proc.communicate()
-        print stdout
-
-        proc = Popen(
-            [sys.executable, 'runme.py', 'Simple_optimized'], stdout=PIPE)
-        (stdout, stderr) = proc.communicate()
-        print stdout
-
-        proc = Popen(
-            [sys.executable, 'runme.py', 'Simple_builtin'], stdout=PIPE)
-        (stdout, stderr) = proc.communicate()
-        print stdout
+        for name in names:
+            proc = Popen(
+                [sys.executable, 'runme.py', name], stdout=PIPE)
+            (stdout, stderr) = proc.communicate()
+            print(stdout.decode())
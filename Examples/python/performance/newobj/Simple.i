@@ -0,0 +1,9 @@
+%inline %{
+struct Node {
+    Node () : value(0), link(this) {}
+    int value;
+    Node *link;
+    Node *next () { return link; }
+    Node copy () const { return *this; }
+};
+%}
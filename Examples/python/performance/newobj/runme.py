@@ -0,0 +1,14 @@
+import sys
+import timeit
+sys.path.append('..')
+import harness
+
+
+def proc(mod):
+    # Each call wraps a returned pointer in a new proxy object
+    setup = 'import %s as mod; n = mod.Node()' % mod.__name__
+    for stmt in ['n.next()', 'n.copy()', 'n.link']:
+        t = timeit.Timer(stmt, setup).timeit(1000000)
+        print("  %-20s %f seconds" % (stmt, t))
+
+harness.run(proc, ['Simple_baseline', 'Simple_optimized', 'Simple_fastthis', 'Simple_builtin'])
@@ -0,0 +1,14 @@
+%module Simple
+
+%include <std_vector.i>
+%include <std_string.i>
+
+%template(DoubleVector) std::vector<double>;
+%template(IntVector) std::vector<int>;
+%template(StringVector) std::vector<std::string>;
+
+%inline %{
+size_t take_doubles(const std::vector<double> &v) { return v.size(); }
+size_t take_ints(const std::vector<int> &v) { return v.size(); }
+size_t take_strings(const std::vector<std::string> &v) { return v.size(); }
+%}
@@ -0,0 +1,25 @@
+import sys
+sys.path.append('..')
+import harness
+import array
+
+
+def proc(mod):
+    # Conversion of 1,000,000 element Python sequences to std::vector
+    n = 1000000
+    inputs = [
+        ("double list", mod.take_doubles, [float(i) for i in range(n)]),
+        ("double tuple", mod.take_doubles, tuple(float(i) for i in range(n))),
+        ("double array", mod.take_doubles, array.array('d', range(n))),
+        ("int list", mod.take_ints, list(range(n))),
+        ("int array", mod.take_ints, array.array('i', range(n))),
+        ("string list", mod.take_strings, [str(i) for i in range(n // 10)] * 10),
+    ]
+    for name, f, seq in inputs:
+        t1 = harness.clock()
+        for i in range(10):
+            f(seq)
+        t2 = harness.clock()
+        print("  %-12s: %f seconds" % (name, t2 - t1))
+
+harness.run(proc)
@@ -0,0 +1,142 @@
+/* Hierarchies 1, 10 and 100 wide: Dn_1 to Dn_n all derive from Basen.
+   Converting an object of the hierarchy n wide to Basen* looks up one of n
+   casts. (Deep hierarchies give the same number of casts, but SWIG takes
+   much longer to process a deep chain of classes.) */
+
+%define %hierarchy(N)
+%inline %{
+class Base ## N {
+public:
+    Base ## N () {}
+    virtual ~Base ## N () {}
+};
+
+int take ## N (Base ## N *) { return 0; }
+%}
+%enddef
+
+%define %derived(NAME, BASE)
+%inline %{
+class NAME : public BASE {
+public:
+    NAME () {}
+};
+%}
+%enddef
+
+%hierarchy(1)
+%derived(D1_1, Base1)
+
+%hierarchy(10)
+%derived(D10_1, Base10)
+%derived(D10_2, Base10)
+%derived(D10_3, Base10)
+%derived(D10_4, Base10)
+%derived(D10_5, Base10)
+%derived(D10_6, Base10)
+%derived(D10_7, Base10)
+%derived(D10_8, Base10)
+%derived(D10_9, Base10)
+%derived(D10_10, Base10)
+
+%hierarchy(100)
+%derived(D100_1, Base100)
+%derived(D100_2, Base100)
+%derived(D100_3, Base100)
+%derived(D100_4, Base100)
+%derived(D100_5, Base100)
+%derived(D100_6, Base100)
+%derived(D100_7, Base100)
+%derived(D100_8, Base100)
+%derived(D100_9, Base100)
+%derived(D100_10, Base100)
+%derived(D100_11, Base100)
+%derived(D100_12, Base100)
+%derived(D100_13, Base100)
+%derived(D100_14, Base100)
+%derived(D100_15, Base100)
+%derived(D100_16, Base100)
+%derived(D100_17, Base100)
+%derived(D100_18, Base100)
+%derived(D100_19, Base100)
+%derived(D100_20, Base100)
+%derived(D100_21, Base100)
+%derived(D100_22, Base100)
+%derived(D100_23, Base100)
+%derived(D100_24, Base100)
+%derived(D100_25, Base100)
+%derived(D100_26, Base100)
+%derived(D100_27, Base100)
+%derived(D100_28, Base100)
+%derived(D100_29, Base100)
+%derived(D100_30, Base100)
+%derived(D100_31, Base100)
+%derived(D100_32, Base100)
+%derived(D100_33, Base100)
+%derived(D100_34, Base100)
+%derived(D100_35, Base100)
+%derived(D100_36, Base100)
+%derived(D100_37, Base100)
+%derived(D100_38, Base100)
+%derived(D100_39, Base100)
+%derived(D100_40, Base100)
+%derived(D100_41, Base100)
+%derived(D100_42, Base100)
+%derived(D100_43, Base100)
+%derived(D100_44, Base100)
+%derived(D100_45, Base100)
+%derived(D100_46, Base100)
+%derived(D100_47, Base100)
+%derived(D100_48, Base100)
+%derived(D100_49, Base100)
+%derived(D100_50, Base100)
+%derived(D100_51, Base100)
+%derived(D100_52, Base100)
+%derived(D100_53, Base100)
+%derived(D100_54, Base100)
+%derived(D100_55, Base100)
+%derived(D100_56, Base100)
+%derived(D100_57, Base100)
+%derived(D100_58, Base100)
+%derived(D100_59, Base100)
+%derived(D100_60, Base100)
+%derived(D100_61, Base100)
+%derived(D100_62, Base100)
+%derived(D100_63, Base100)
+%derived(D100_64, Base100)
+%derived(D100_65, Base100)
+%derived(D100_66, Base100)
+%derived(D100_67, Base100)
+%derived(D100_68, Base100)
+%derived(D100_69, Base100)
+%derived(D100_70, Base100)
+%derived(D100_71, Base100)
+%derived(D100_72, Base100)
+%derived(D100_73, Base100)
+%derived(D100_74, Base100)
+%derived(D100_75, Base100)
+%derived(D100_76, Base100)
+%derived(D100_77, Base100)
+%derived(D100_78, Base100)
+%derived(D100_79, Base100)
+%derived(D100_80, Base100)
+%derived(D100_81, Base100)
+%derived(D100_82, Base100)
+%derived(D100_83, Base100)
+%derived(D100_84, Base100)
+%derived(D100_85, Base100)
+%derived(D100_86, Base100)
+%derived(D100_87, Base100)
+%derived(D100_88, Base100)
+%derived(D100_89, Base100)
+%derived(D100_90, Base100)
+%derived(D100_91, Base100)
+%derived(D100_92, Base100)
+%derived(D100_93, Base100)
+%derived(D100_94, Base100)
+%derived(D100_95, Base100)
+%derived(D100_96, Base100)
+%derived(D100_97, Base100)
+%derived(D100_98, Base100)
+%derived(D100_99, Base100)
+%derived(D100_100, Base100)
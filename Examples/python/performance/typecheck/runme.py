@@ -0,0 +1,20 @@
+import sys
+sys.path.append('..')
+import harness
+
+
+def proc(mod):
+    # Pass objects of every class of the hierarchy in turn, so that looking
+    # up the same cast again does not help
+    for width in [1, 10, 100]:
+        take = getattr(mod, 'take%d' % width)
+        objs = [getattr(mod, 'D%d_%d' % (width, k + 1))() for k in range(width)]
+        objs = objs * (100 // width)
+        t1 = harness.clock()
+        for i in range(10000):
+            for x in objs:
+                take(x)
+        t2 = harness.clock()
+        print("  width %3d: %f seconds" % (width, t2 - t1))
+
+harness.run(proc)
@@ -0,0 +1,28 @@
+/* Types looked up by name, as typemaps and factory.i do with SWIG_TypeQuery.
+   The lookups are done from C++, as the Python SWIG_TypeQuery caches them. */
+
+%define %types(N)
+%inline %{
+struct Type##N { int value() const { return N; } };
+%}
+%enddef
+
+%types(0) %types(1) %types(2) %types(3) %types(4) %types(5) %types(6) %types(7) %types(8) %types(9)
+%types(10) %types(11) %types(12) %types(13) %types(14) %types(15) %types(16) %types(17) %types(18) %types(19)
+%types(20) %types(21) %types(22) %types(23) %types(24) %types(25) %types(26) %types(27) %types(28) %types(29)
+%types(30) %types(31) %types(32) %types(33) %types(34) %types(35) %types(36) %types(37) %types(38) %types(39)
+%types(40) %types(41) %types(42) %types(43) %types(44) %types(45) %types(46) %types(47) %types(48) %types(49)
+
+%inline %{
+/* Look up name n times, returns the number of lookups that found it */
+int query(const char *name, int n) {
+  swig_module_info *module = SWIG_GetModule(0);
+  int found = 0;
+  int i;
+  for (i = 0; i < n; ++i) {
+    if (SWIG_TypeQueryModule(module, module, name))
+      ++found;
+  }
+  return found;
+}
+%}
@@ -0,0 +1,13 @@
+import sys
+import timeit
+sys.path.append('..')
+import harness
+
+
+def proc(mod):
+    for name in ['_p_Type49', 'Type49 *', 'Missing *']:
+        stmt = 'mod.query(%r, 100000)' % name
+        t = timeit.Timer(stmt, 'import %s as mod' % mod.__name__).timeit(10)
+        print("  %-30s %f seconds" % (stmt, t))
+
+harness.run(proc)
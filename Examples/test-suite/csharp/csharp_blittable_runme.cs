@@ -0,0 +1,72 @@
+using System;
+using csharp_blittableNamespace;
+
+public class runme
+{
+  static void Main()
+  {
+    Vec3 a = csharp_blittable.make_vec3(1, 2, 3);
+    if (a.x != 1 || a.y != 2 || a.z != 3)
+      throw new Exception("make_vec3 failed");
+
+    Vec3 b = new Vec3();
+    b.x = 10;
+    b.y = 20;
+    b.z = 30;
+    Vec3 sum = csharp_blittable.add(a, b);
+    if (sum.x != 11 || sum.y != 22 || sum.z != 33)
+      throw new Exception("add failed");
+
+    csharp_blittable.scale(ref sum, 2);
+    if (sum.x != 22 || sum.y != 44 || sum.z != 66)
+      throw new Exception("scale failed");
+
+    Segment s = new Segment();
+    s.start = a;
+    s.end = b;
+    s.weight = 1.5;
+    s.id = 1L << 40;
+    s.flags = 0xffffffff;
+    s.kind = (int)Kind.KindArrow;
+    csharp_blittable.reverse(ref s);
+    if (s.start.x != 10 || s.end.x != 1 || s.weight != 1.5 || s.id != 1L << 40 || s.flags != 0xffffffff || s.kind != (int)Kind.KindArrow)
+      throw new Exception("reverse failed");
+
+    Segment[] segments = new Segment[3];
+    for (int i = 0; i < segments.Length; i++)
+      segments[i].weight = i + 1;
+    if (csharp_blittable.length_sum(ref segments[0], segments.Length) != 6)
+      throw new Exception("length_sum failed");
+
+    csharp_blittable.origin_vec3 = a;
+    Vec3 origin = csharp_blittable.origin();
+    if (origin.x != 1 || csharp_blittable.origin_vec3.z != 3)
+      throw new Exception("origin failed");
+
+    // Returned pointers are copies of the C++ struct
+    origin.x = 100;
+    if (csharp_blittable.origin_vec3.x != 1 || csharp_blittable.const_origin().x != 1)
+      throw new Exception("origin copy failed");
+    if (csharp_blittable.sum_vec3(ref a) != 6)
+      throw new Exception("sum_vec3 failed");
+
+    try {
+      csharp_blittable.null_vec3();
+      throw new Exception("null_vec3 did not throw");
+    } catch (NullReferenceException) {
+    }
+    try {
+      csharp_blittable.const_null_vec3();
+      throw new Exception("const_null_vec3 did not throw");
+    } catch (NullReferenceException) {
+    }
+
+    Holder holder = new Holder();
+    Vec3 position = holder.position;
+    if (position.x != 1)
+      throw new Exception("Holder.position get failed");
+    holder.position = b;
+    if (holder.position.y != 20)
+      throw new Exception("Holder.position set failed");
+  }
+}
@@ -0,0 +1,57 @@
+using System;
+using csharp_constants_foldNamespace;
+
+public class runme
+{
+  static void Main()
+  {
+    // %csconst(1) constants evaluated by SWIG, usable in a switch statement
+    int number = -5;
+    switch (number) {
+      case csharp_constants_fold.NEGATIVE:
+        break;
+      case Sizes.Bytes:
+        break;
+      default:
+        throw new Exception("switch");
+    }
+    if (csharp_constants_fold.UNSIGNED_HEX != 0xFFFFFFFF)
+      throw new Exception("UNSIGNED_HEX");
+    if (csharp_constants_fold.BIG_SHIFT != 1099511627776)
+      throw new Exception("BIG_SHIFT");
+    if (csharp_constants_fold.NEGATIVE != -5)
+      throw new Exception("NEGATIVE");
+    if ((int)Flags.FlagB != 2 || (int)Flags.FlagC != 3 || (int)Flags.FlagAll != 3)
+      throw new Exception("Flags");
+    if (Sizes.Bytes != 4)
+      throw new Exception("Sizes.Bytes");
+    if ((int)Sizes.Nested.Second != 11 || (int)Sizes.Nested.Third != 4)
+      throw new Exception("Sizes.Nested");
+    if (csharp_constants_fold.UNSIGNED_WRAP != 1)
+      throw new Exception("UNSIGNED_WRAP");
+    if (csharp_constants_fold.SIGN_SHIFT != int.MinValue)
+      throw new Exception("SIGN_SHIFT");
+
+    // %csconst(0) constants obtained from C
+    if (csharp_constants_fold.RUNTIME_INT != 42)
+      throw new Exception("RUNTIME_INT");
+    if (csharp_constants_fold.RUNTIME_UINT != 4000000000U)
+      throw new Exception("RUNTIME_UINT");
+    if (csharp_constants_fold.RUNTIME_LLONG != -1099511627776)
+      throw new Exception("RUNTIME_LLONG");
+    if (csharp_constants_fold.RUNTIME_DOUBLE != 2.5)
+      throw new Exception("RUNTIME_DOUBLE");
+    if (csharp_constants_fold.RUNTIME_FLOAT != 1.5f)
+      throw new Exception("RUNTIME_FLOAT");
+    if (!csharp_constants_fold.RUNTIME_BOOL)
+      throw new Exception("RUNTIME_BOOL");
+    if (csharp_constants_fold.RUNTIME_STRING != "str")
+      throw new Exception("RUNTIME_STRING");
+    if (RuntimeEnum.RuntimeB != (RuntimeEnum)4)
+      throw new Exception("RuntimeEnum");
+    if (RuntimeStatics.Member != -5)
+      throw new Exception("RuntimeStatics.Member");
+    if (RuntimeStatics.EnumMember != RuntimeEnum.RuntimeB)
+      throw new Exception("RuntimeStatics.EnumMember");
+  }
+}
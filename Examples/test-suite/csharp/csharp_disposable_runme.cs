@@ -0,0 +1,60 @@
+using System;
+using csharp_disposableNamespace;
+
+public class runme
+{
+  static void Main()
+  {
+    // The owning proxy classes have no finalizer, only Dispose() deletes the C++ object.
+    if (typeof(Particle).GetMethod("Finalize", System.Reflection.BindingFlags.NonPublic | System.Reflection.BindingFlags.Instance | System.Reflection.BindingFlags.DeclaredOnly) != null)
+      throw new Exception("Particle has a finalizer");
+    if (typeof(HeavyParticle).GetMethod("Finalize", System.Reflection.BindingFlags.NonPublic | System.Reflection.BindingFlags.Instance | System.Reflection.BindingFlags.DeclaredOnly) != null)
+      throw new Exception("HeavyParticle has a finalizer");
+
+    int instances = Particle.instances;
+    using (Particle p = new Particle(2.0)) {
+      if (Particle.instances != instances + 1)
+        throw new Exception("Particle not created");
+      if (mass_of_object(p) != 2.0)
+        throw new Exception("mass_of_object failed");
+      if (csharp_disposable.mass_of(p.GetHandle()) != 2.0)
+        throw new Exception("mass_of with handle failed");
+    }
+    if (Particle.instances != instances)
+      throw new Exception("Particle not deleted by Dispose");
+
+    using (HeavyParticle h = new HeavyParticle()) {
+      if (csharp_disposable.mass_of(h.GetHandle().ToObject().GetHandle()) != 100.0)
+        throw new Exception("HeavyParticle handle failed");
+      h.Dispose();
+    }
+    if (Particle.instances != instances)
+      throw new Exception("HeavyParticle not deleted by Dispose");
+
+    using (Emitter e = new Emitter()) {
+      // Borrowed references are returned as handles.
+      Particle.Handle handle = e.get(1);
+      if (handle.IsNull)
+        throw new Exception("get returned null handle");
+      if (csharp_disposable.mass_of(handle) != 1.0)
+        throw new Exception("mass_of with returned handle failed");
+      Particle borrowed = handle.ToObject();
+      borrowed.mass = 3.0;
+      borrowed.Dispose();
+      if (e.get(1).ToObject().mass != 3.0)
+        throw new Exception("borrowed proxy failed");
+      if (e.first().ToObject().mass != 1.0)
+        throw new Exception("first failed");
+      if (e.at(1).mass != 3.0)
+        throw new Exception("at failed");
+      if (!e.heavy().IsNull || e.heavy().ToObject() != null)
+        throw new Exception("heavy failed");
+      if (csharp_disposable.mass_of(new Particle.Handle()) != -1.0)
+        throw new Exception("mass_of with null handle failed");
+    }
+  }
+
+  static double mass_of_object(Particle p) {
+    return csharp_disposable.mass_of_object(p);
+  }
+}
@@ -0,0 +1,58 @@
+using System;
+using csharp_std_string_utf8Namespace;
+
+public class runme
+{
+  static void Main()
+  {
+    string s = "café € \U0001F600";
+    if (csharp_std_string_utf8.echo(s) != s)
+      throw new Exception("echo failed");
+    if (csharp_std_string_utf8.echo("") != "")
+      throw new Exception("echo of empty string failed");
+    if (csharp_std_string_utf8.length(s) != System.Text.Encoding.UTF8.GetByteCount(s))
+      throw new Exception("string not passed as UTF-8");
+    if (csharp_std_string_utf8.concat(s, csharp_std_string_utf8.echo("!")) != s + "!")
+      throw new Exception("concat failed");
+    if (csharp_std_string_utf8.with_nul() != "a\0b")
+      throw new Exception("embedded NUL not returned");
+    if (csharp_std_string_utf8.length("a\0b") != 3)
+      throw new Exception("embedded NUL not passed");
+
+    string big = new string('x', 10000) + s;
+    if (csharp_std_string_utf8.echo(big) != big)
+      throw new Exception("echo of a long string failed");
+
+    try {
+      csharp_std_string_utf8.echo(null);
+      throw new Exception("null string not rejected");
+    } catch (ArgumentNullException) {
+    }
+    // The buffers must still be balanced after the exception
+    if (csharp_std_string_utf8.concat("a", "b") != "ab")
+      throw new Exception("concat after exception failed");
+
+    using (Holder h = new Holder()) {
+      h.text = s;
+      if (h.text != s || h.get() != s)
+        throw new Exception("Holder failed");
+    }
+
+    using (Greeter g = new Greeter()) {
+      if (g.call_greet(s) != "Hello " + s)
+        throw new Exception("Greeter failed");
+    }
+    using (Greeter g = new CustomGreeter()) {
+      if (g.call_greet(s) != "Bonjour " + s)
+        throw new Exception("CustomGreeter failed");
+    }
+  }
+}
+
+public class CustomGreeter : Greeter
+{
+  public override string greet(string name)
+  {
+    return "Bonjour " + name;
+  }
+}
@@ -528,6 +528,37 @@ public class li_std_vector_runme {
       li_std_vector.halve_in_place(dvec);
     }
 
+    // Bulk copying of blittable elements
+    {
+      DoubleVector dv = DoubleVector.FromArray(new double[] {1.5, 2.5, 3.5, 4.5});
+      if (dv.Count != 4 || dv[3] != 4.5)
+        throw new Exception("FromArray test failed");
+      dv.SetArray(1, new double[] {20.0, 30.0});
+      double[] da = dv.ToArray();
+      if (da.Length != 4 || da[0] != 1.5 || da[1] != 20.0 || da[2] != 30.0 || da[3] != 4.5)
+        throw new Exception("ToArray test failed");
+      double[] range = new double[3];
+      dv.CopyTo(1, range, 1, 2);
+      if (range[0] != 0.0 || range[1] != 20.0 || range[2] != 30.0)
+        throw new Exception("CopyTo range test failed");
+      dv.AddArray(new double[] {5.5});
+      if (dv.Count != 5 || dv[4] != 5.5)
+        throw new Exception("AddArray test failed");
+      try {
+        dv.SetArray(4, new double[] {1.0, 2.0});
+        throw new Exception("SetArray out of range test failed");
+      } catch (ArgumentOutOfRangeException) {
+      }
+      try {
+        dv.SetArray(int.MaxValue, new double[] {1.0, 2.0});
+        throw new Exception("SetArray overflowing index test failed");
+      } catch (ArgumentOutOfRangeException) {
+      }
+      string[] sa = new StringVector(new string[] {"a", "b"}).ToArray();
+      if (sa.Length != 2 || sa[1] != "b")
+        throw new Exception("StringVector ToArray test failed");
+    }
+
     // Dispose()
     {
       using (StructVector vs = new StructVector( new Struct[] { new Struct(0.0), new Struct(11.1) } ) )
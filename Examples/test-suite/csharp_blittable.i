@@ -0,0 +1,80 @@
+%module csharp_blittable
+
+%include <blittable.i>
+
+%cs_blittable(Vec3)
+%cs_blittable(Segment)
+
+%inline %{
+typedef unsigned int Flags;
+enum Kind { KindLine, KindArrow };
+
+struct Vec3 {
+  float x, y, z;
+};
+
+struct Segment {
+  Vec3 start;
+  Vec3 end;
+  double weight;
+  long long id;
+  Flags flags;
+  enum Kind kind;
+  void *tag;
+};
+
+Vec3 make_vec3(float x, float y, float z) {
+  Vec3 v = { x, y, z };
+  return v;
+}
+
+Vec3 add(Vec3 a, const Vec3 &b) {
+  Vec3 v = { a.x + b.x, a.y + b.y, a.z + b.z };
+  return v;
+}
+
+void scale(Vec3 *v, float factor) {
+  v->x *= factor;
+  v->y *= factor;
+  v->z *= factor;
+}
+
+void reverse(Segment &s) {
+  Vec3 tmp = s.start;
+  s.start = s.end;
+  s.end = tmp;
+}
+
+static Vec3 origin_vec3 = { 0, 0, 0 };
+Vec3 *origin() {
+  return &origin_vec3;
+}
+
+Vec3 *null_vec3() {
+  return 0;
+}
+
+const Vec3 *const_origin() {
+  return &origin_vec3;
+}
+
+const Vec3 *const_null_vec3() {
+  return 0;
+}
+
+float sum_vec3(const Vec3 *v) {
+  return v->x + v->y + v->z;
+}
+
+double length_sum(const Segment *segments, int n) {
+  double sum = 0;
+  for (int i = 0; i < n; i++)
+    sum += segments[i].weight;
+  return sum;
+}
+
+struct Holder {
+  Vec3 position;
+  Holder() { position.x = position.y = position.z = 1; }
+};
+%}
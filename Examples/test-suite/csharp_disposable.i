@@ -0,0 +1,34 @@
+%module csharp_disposable
+
+%include <disposable.i>
+
+%cs_disposable(Particle)
+%cs_disposable(HeavyParticle)
+%cs_disposable(Emitter)
+
+%apply SWIGTYPE *HANDLE { Particle *particle, Particle *get, Particle &first, HeavyParticle *heavy }
+
+%inline %{
+struct Particle {
+  static int instances;
+  double mass;
+  Particle(double mass = 1.0) : mass(mass) { ++instances; }
+  virtual ~Particle() { --instances; }
+};
+int Particle::instances = 0;
+
+struct HeavyParticle : Particle {
+  HeavyParticle() : Particle(100.0) {}
+};
+
+struct Emitter {
+  Particle particles[4];
+  Particle *get(int i) { return &particles[i]; }
+  Particle &first() { return particles[0]; }
+  Particle *at(int i) { return &particles[i]; }
+  HeavyParticle *heavy() { return 0; }
+};
+
+double mass_of(Particle *particle) { return particle ? particle->mass : -1.0; }
+double mass_of_object(Particle *p) { return p->mass; }
+%}
@@ -0,0 +1,26 @@
+%module(directors="1") csharp_std_string_utf8
+
+%include <std_string_utf8.i>
+
+%feature("director") Greeter;
+
+%inline %{
+#include <string>
+
+std::string echo(const std::string &s) { return s; }
+std::string concat(std::string a, const std::string &b) { return a + b; }
+size_t length(const std::string &s) { return s.size(); }
+std::string with_nul() { return std::string("a\0b", 3); }
+
+struct Holder {
+  std::string text;
+  const std::string &get() const { return text; }
+};
+
+class Greeter {
+public:
+  virtual ~Greeter() {}
+  virtual std::string greet(const std::string &name) { return "Hello " + name; }
+  std::string call_greet(const std::string &name) { return greet(name); }
+};
+%}
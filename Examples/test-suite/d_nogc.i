@@ -0,0 +1,57 @@
+%module d_nogc
+
+%include <slices.i>
+
+%warnfilter(SWIGWARN_D_NOGC_IGNORED) copied;
+%warnfilter(SWIGWARN_D_NOGC_IGNORED) Counter::self;
+
+%feature("d:nogc");
+
+%apply (const double *SLICE, size_t LENGTH) { (const double *values, size_t count) }
+%apply (const int *SLICE, size_t LENGTH) { (const int *values, size_t count) }
+%apply (int *SLICE, size_t LENGTH) { (int *values, size_t count) }
+%apply (const char *STRING, size_t LENGTH) { (const char *str, size_t len) }
+%apply const char *BORROWED { const char *label }
+
+%inline %{
+  enum Color { RED, GREEN };
+
+  int add(int a, int b) { return a + b; }
+  Color other(const Color &c) { return c == RED ? GREEN : RED; }
+  int *identity(int *p) { return p; }
+
+  double sum(const double *values, size_t count) {
+    double s = 0;
+    for (size_t i = 0; i < count; ++i)
+      s += values[i];
+    return s;
+  }
+
+  void twice(int *values, size_t count) {
+    for (size_t i = 0; i < count; ++i)
+      values[i] *= 2;
+  }
+
+  size_t count_a(const char *str, size_t len) {
+    size_t n = 0;
+    for (size_t i = 0; i < len; ++i)
+      n += str[i] == 'a';
+    return n;
+  }
+
+  const char *label() { return "label"; }
+  const char *copied() { return "copied"; }
+
+  struct Counter {
+    int value;
+    Counter() : value(0) {}
+    int increment(int by) { return value += by; }
+    int total(const int *values, size_t count) const {
+      int s = 0;
+      for (size_t i = 0; i < count; ++i)
+        s += values[i];
+      return s;
+    }
+    Counter *self() { return this; }
+  };
+%}
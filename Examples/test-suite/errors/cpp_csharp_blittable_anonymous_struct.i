@@ -0,0 +1,16 @@
+%module xxx
+
+%include <blittable.i>
+
+%cs_blittable(AnonymousStruct)
+
+%inline %{
+struct AnonymousStruct {
+  short a;
+  struct {
+    short s1;
+    double s2;
+  };
+  int b;
+};
+%}
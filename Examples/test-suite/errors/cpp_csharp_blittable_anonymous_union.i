@@ -0,0 +1,16 @@
+%module xxx
+
+%include <blittable.i>
+
+%cs_blittable(AnonymousUnion)
+
+%inline %{
+struct AnonymousUnion {
+  int a;
+  union {
+    int u1;
+    double u2;
+  };
+  int b;
+};
+%}
@@ -0,0 +1,19 @@
+%module xxx
+
+%include <blittable.i>
+
+%cs_blittable(UnnamedNested)
+
+%inline %{
+struct UnnamedNested {
+  int a;
+  struct {
+    char c1, c2;
+  } inner1, inner2;
+  union {
+    int u1;
+    double u2;
+  } inner3;
+  int b;
+};
+%}
@@ -0,0 +1,184 @@
+# This file was automatically generated by SWIG (http://www.swig.org).
+# Version 3.0.11
+#
+# Do not make changes to this file unless you know what you are doing--modify
+# the SWIG interface file instead.
+
+
+
+
+
+from sys import version_info as _swig_python_version_info
+if _swig_python_version_info >= (2, 7, 0):
+    def swig_import_helper():
+        import importlib
+        pkg = __name__.rpartition('.')[0]
+        mname = '.'.join((pkg, '_cpp_shared_ptr')).lstrip('.')
+        try:
+            return importlib.import_module(mname)
+        except ImportError:
+            return importlib.import_module('_cpp_shared_ptr')
+    _cpp_shared_ptr = swig_import_helper()
+    del swig_import_helper
+elif _swig_python_version_info >= (2, 6, 0):
+    def swig_import_helper():
+        from os.path import dirname
+        import imp
+        fp = None
+        try:
+            fp, pathname, description = imp.find_module('_cpp_shared_ptr', [dirname(__file__)])
+        except ImportError:
+            import _cpp_shared_ptr
+            return _cpp_shared_ptr
+        if fp is not None:
+            try:
+                _mod = imp.load_module('_cpp_shared_ptr', fp, pathname, description)
+            finally:
+                fp.close()
+            return _mod
+    _cpp_shared_ptr = swig_import_helper()
+    del swig_import_helper
+else:
+    import _cpp_shared_ptr
+del _swig_python_version_info
+try:
+    _swig_property = property
+except NameError:
+    pass  # Python < 2.2 doesn't have 'property'.
+
+try:
+    import builtins as __builtin__
+except ImportError:
+    import __builtin__
+
+def _swig_setattr_nondynamic(self, class_type, name, value, static=1):
+    if (name == "thisown"):
+        return self.this.own(value)
+    if (name == "this"):
+        if type(value).__name__ == 'SwigPyObject':
+            self.__dict__[name] = value
+            return
+    method = class_type.__swig_setmethods__.get(name, None)
+    if method:
+        return method(self, value)
+    if (not static):
+        if _newclass:
+            object.__setattr__(self, name, value)
+        else:
+            self.__dict__[name] = value
+    else:
+        raise AttributeError("You cannot add attributes to %s" % self)
+
+
+def _swig_setattr(self, class_type, name, value):
+    return _swig_setattr_nondynamic(self, class_type, name, value, 0)
+
+
+def _swig_getattr(self, class_type, name):
+    if (name == "thisown"):
+        return self.this.own()
+    method = class_type.__swig_getmethods__.get(name, None)
+    if method:
+        return method(self)
+    raise AttributeError("'%s' object has no attribute '%s'" % (class_type.__name__, name))
+
+
+def _swig_repr(self):
+    try:
+        strthis = "proxy of " + self.this.__repr__()
+    except __builtin__.Exception:
+        strthis = ""
+    return "<%s.%s; %s >" % (self.__class__.__module__, self.__class__.__name__, strthis,)
+
+try:
+    _object = object
+    _newclass = 1
+except __builtin__.Exception:
+    class _object:
+        pass
+    _newclass = 0
+
+SHARED_PTR_DISOWN = _cpp_shared_ptr.SHARED_PTR_DISOWN
+class A(_object):
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, A, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, A, name)
+    __repr__ = _swig_repr
+    __swig_destroy__ = _cpp_shared_ptr.delete_A
+    __del__ = lambda self: None
+
+    def __init__(self):
+        this = _cpp_shared_ptr.new_A()
+        try:
+            self.this.append(this)
+        except __builtin__.Exception:
+            self.this = this
+A_swigregister = _cpp_shared_ptr.A_swigregister
+A_swigregister(A)
+
+class B(_object):
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, B, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, B, name)
+    __repr__ = _swig_repr
+    __swig_destroy__ = _cpp_shared_ptr.delete_B
+    __del__ = lambda self: None
+
+    def __init__(self):
+        this = _cpp_shared_ptr.new_B()
+        try:
+            self.this.append(this)
+        except __builtin__.Exception:
+            self.this = this
+B_swigregister = _cpp_shared_ptr.B_swigregister
+B_swigregister(B)
+
+class C(B, A):
+    __swig_setmethods__ = {}
+    for _s in [B, A]:
+        __swig_setmethods__.update(getattr(_s, '__swig_setmethods__', {}))
+    __setattr__ = lambda self, name, value: _swig_setattr(self, C, name, value)
+    __swig_getmethods__ = {}
+    for _s in [B, A]:
+        __swig_getmethods__.update(getattr(_s, '__swig_getmethods__', {}))
+    __getattr__ = lambda self, name: _swig_getattr(self, C, name)
+    __repr__ = _swig_repr
+    __swig_destroy__ = _cpp_shared_ptr.delete_C
+    __del__ = lambda self: None
+
+    def __init__(self):
+        this = _cpp_shared_ptr.new_C()
+        try:
+            self.this.append(this)
+        except __builtin__.Exception:
+            self.this = this
+C_swigregister = _cpp_shared_ptr.C_swigregister
+C_swigregister(C)
+
+class D(C):
+    __swig_setmethods__ = {}
+    for _s in [C]:
+        __swig_setmethods__.update(getattr(_s, '__swig_setmethods__', {}))
+    __setattr__ = lambda self, name, value: _swig_setattr(self, D, name, value)
+    __swig_getmethods__ = {}
+    for _s in [C]:
+        __swig_getmethods__.update(getattr(_s, '__swig_getmethods__', {}))
+    __getattr__ = lambda self, name: _swig_getattr(self, D, name)
+    __repr__ = _swig_repr
+    __swig_destroy__ = _cpp_shared_ptr.delete_D
+    __del__ = lambda self: None
+
+    def __init__(self):
+        this = _cpp_shared_ptr.new_D()
+        try:
+            self.this.append(this)
+        except __builtin__.Exception:
+            self.this = this
+D_swigregister = _cpp_shared_ptr.D_swigregister
+D_swigregister(D)
+
+# This file is compatible with both classic and new-style classes.
+
+
@@ -0,0 +1,183 @@
+# This file was automatically generated by SWIG (http://www.swig.org).
+# Version 3.0.11
+#
+# Do not make changes to this file unless you know what you are doing--modify
+# the SWIG interface file instead.
+
+
+
+
+
+from sys import version_info as _swig_python_version_info
+if _swig_python_version_info >= (2, 7, 0):
+    def swig_import_helper():
+        import importlib
+        pkg = __name__.rpartition('.')[0]
+        mname = '.'.join((pkg, '_cpp_template_friend')).lstrip('.')
+        try:
+            return importlib.import_module(mname)
+        except ImportError:
+            return importlib.import_module('_cpp_template_friend')
+    _cpp_template_friend = swig_import_helper()
+    del swig_import_helper
+elif _swig_python_version_info >= (2, 6, 0):
+    def swig_import_helper():
+        from os.path import dirname
+        import imp
+        fp = None
+        try:
+            fp, pathname, description = imp.find_module('_cpp_template_friend', [dirname(__file__)])
+        except ImportError:
+            import _cpp_template_friend
+            return _cpp_template_friend
+        if fp is not None:
+            try:
+                _mod = imp.load_module('_cpp_template_friend', fp, pathname, description)
+            finally:
+                fp.close()
+            return _mod
+    _cpp_template_friend = swig_import_helper()
+    del swig_import_helper
+else:
+    import _cpp_template_friend
+del _swig_python_version_info
+try:
+    _swig_property = property
+except NameError:
+    pass  # Python < 2.2 doesn't have 'property'.
+
+try:
+    import builtins as __builtin__
+except ImportError:
+    import __builtin__
+
+def _swig_setattr_nondynamic(self, class_type, name, value, static=1):
+    if (name == "thisown"):
+        return self.this.own(value)
+    if (name == "this"):
+        if type(value).__name__ == 'SwigPyObject':
+            self.__dict__[name] = value
+            return
+    method = class_type.__swig_setmethods__.get(name, None)
+    if method:
+        return method(self, value)
+    if (not static):
+        if _newclass:
+            object.__setattr__(self, name, value)
+        else:
+            self.__dict__[name] = value
+    else:
+        raise AttributeError("You cannot add attributes to %s" % self)
+
+
+def _swig_setattr(self, class_type, name, value):
+    return _swig_setattr_nondynamic(self, class_type, name, value, 0)
+
+
+def _swig_getattr(self, class_type, name):
+    if (name == "thisown"):
+        return self.this.own()
+    method = class_type.__swig_getmethods__.get(name, None)
+    if method:
+        return method(self)
+    raise AttributeError("'%s' object has no attribute '%s'" % (class_type.__name__, name))
+
+
+def _swig_repr(self):
+    try:
+        strthis = "proxy of " + self.this.__repr__()
+    except __builtin__.Exception:
+        strthis = ""
+    return "<%s.%s; %s >" % (self.__class__.__module__, self.__class__.__name__, strthis,)
+
+try:
+    _object = object
+    _newclass = 1
+except __builtin__.Exception:
+    class _object:
+        pass
+    _newclass = 0
+
+class MyTemplate1(_object):
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, MyTemplate1, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, MyTemplate1, name)
+    __repr__ = _swig_repr
+
+    def __init__(self):
+        this = _cpp_template_friend.new_MyTemplate1()
+        try:
+            self.this.append(this)
+        except __builtin__.Exception:
+            self.this = this
+    __swig_destroy__ = _cpp_template_friend.delete_MyTemplate1
+    __del__ = lambda self: None
+MyTemplate1_swigregister = _cpp_template_friend.MyTemplate1_swigregister
+MyTemplate1_swigregister(MyTemplate1)
+
+class MyTemplate2(_object):
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, MyTemplate2, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, MyTemplate2, name)
+    __repr__ = _swig_repr
+
+    def __init__(self):
+        this = _cpp_template_friend.new_MyTemplate2()
+        try:
+            self.this.append(this)
+        except __builtin__.Exception:
+            self.this = this
+    __swig_destroy__ = _cpp_template_friend.delete_MyTemplate2
+    __del__ = lambda self: None
+MyTemplate2_swigregister = _cpp_template_friend.MyTemplate2_swigregister
+MyTemplate2_swigregister(MyTemplate2)
+
+
+def normal_friend1(arg1):
+    return _cpp_template_friend.normal_friend1(arg1)
+normal_friend1 = _cpp_template_friend.normal_friend1
+class MyClass1(_object):
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, MyClass1, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, MyClass1, name)
+    __repr__ = _swig_repr
+
+    def __init__(self):
+        this = _cpp_template_friend.new_MyClass1()
+        try:
+            self.this.append(this)
+        except __builtin__.Exception:
+            self.this = this
+    __swig_destroy__ = _cpp_template_friend.delete_MyClass1
+    __del__ = lambda self: None
+MyClass1_swigregister = _cpp_template_friend.MyClass1_swigregister
+MyClass1_swigregister(MyClass1)
+
+
+def normal_friend2(arg1):
+    return _cpp_template_friend.normal_friend2(arg1)
+normal_friend2 = _cpp_template_friend.normal_friend2
+class MyClass2(_object):
+    __swig_setmethods__ = {}
+    __setattr__ = lambda self, name, value: _swig_setattr(self, MyClass2, name, value)
+    __swig_getmethods__ = {}
+    __getattr__ = lambda self, name: _swig_getattr(self, MyClass2, name)
+    __repr__ = _swig_repr
+
+    def __init__(self):
+        this = _cpp_template_friend.new_MyClass2()
+        try:
+            self.this.append(this)
+        except __builtin__.Exception:
+            self.this = this
+    __swig_destroy__ = _cpp_template_friend.delete_MyClass2
+    __del__ = lambda self: None
+MyClass2_swigregister = _cpp_template_friend.MyClass2_swigregister
+MyClass2_swigregister(MyClass2)
+
+# This file is compatible with both classic and new-style classes.
+
+
@@ -0,0 +1,56 @@
+package main
+
+import "./go_batch"
+
+func main() {
+	args := []go_batch.AddBatchArgs{{1, 2}, {3, 4}, {5, 6}}
+	results := make([]int, len(args))
+	go_batch.AddBatch(args, results)
+	for i, a := range args {
+		if results[i] != a.A+a.B {
+			panic(results)
+		}
+	}
+
+	sargs := []go_batch.ScaleBatchArgs{{X: 2, F: 1.5, S: 2}, {X: 1, F: 2, S: 3, Negate: true}}
+	sresults := make([]float64, len(sargs))
+	go_batch.ScaleBatch(sargs, sresults)
+	if sresults[0] != 6 || sresults[1] != -6 {
+		panic(sresults)
+	}
+
+	go_batch.AccumulateBatch([]go_batch.AccumulateBatchArgs{{1}, {2.5}, {0.5}})
+	if go_batch.Get_total() != 4 {
+		panic(go_batch.Get_total())
+	}
+
+	tresults := make([]int64, 2)
+	go_batch.CounterTwiceBatch([]go_batch.CounterTwiceBatchArgs{{21}, {-4}}, tresults)
+	if tresults[0] != 42 || tresults[1] != -8 {
+		panic(tresults)
+	}
+
+	// Empty batches do nothing.
+	go_batch.AddBatch(nil, nil)
+
+	func() {
+		defer func() {
+			if recover() == nil {
+				panic("short results slice not detected")
+			}
+		}()
+		go_batch.AddBatch(args, results[:1])
+	}()
+
+	if m := go_batch.Mean([]float64{1, 2, 3, 4}); m != 2.5 {
+		panic(m)
+	}
+
+	buf := make([]int32, 4)
+	go_batch.Fill(buf)
+	for i, v := range buf {
+		if v != int32(i*10) {
+			panic(buf)
+		}
+	}
+}
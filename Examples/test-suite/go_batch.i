@@ -0,0 +1,45 @@
+// Test the go:batch feature and the SLICE typemaps.
+
+%module go_batch
+
+%include <typemaps.i>
+
+%feature("go:batch") add;
+%feature("go:batch") scale;
+%feature("go:batch") accumulate;
+%feature("go:batch") Counter::twice;
+
+%apply (const double *SLICE, size_t LENGTH) { (const double *samples, int count) };
+%apply (int *SLICE, size_t LENGTH) { (int *out, size_t n) };
+
+%inline
+%{
+#include <stddef.h>
+
+int add(int a, int b) { return a + b; }
+
+double scale(double x, float f, short s, bool negate) {
+  double r = x * f * s;
+  return negate ? -r : r;
+}
+
+static double total = 0;
+void accumulate(double value) { total += value; }
+double get_total() { return total; }
+
+struct Counter {
+  static long long twice(long long x) { return 2 * x; }
+};
+
+double mean(const double *samples, int count) {
+  double sum = 0;
+  for (int i = 0; i < count; ++i)
+    sum += samples[i];
+  return count ? sum / count : 0;
+}
+
+void fill(int *out, size_t n) {
+  for (size_t i = 0; i < n; ++i)
+    out[i] = (int)i * 10;
+}
+%}
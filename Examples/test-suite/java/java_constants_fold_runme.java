@@ -0,0 +1,60 @@
+import java_constants_fold.*;
+
+public class java_constants_fold_runme {
+  static {
+    try {
+        System.loadLibrary("java_constants_fold");
+    } catch (UnsatisfiedLinkError e) {
+      System.err.println("Native code library failed to load. See the chapter on Dynamic Linking Problems in the SWIG Java documentation for help.\n" + e);
+      System.exit(1);
+    }
+  }
+
+  public static void main(String argv[]) 
+  {
+    // %javaconst(1) constants evaluated by SWIG, usable in a switch statement
+    int number = -5;
+    switch (number) {
+      case java_constants_fold.NEGATIVE:
+        break;
+      case Sizes.Bytes:
+        break;
+      default:
+        throw new RuntimeException("switch");
+    }
+    if (java_constants_fold.UNSIGNED_HEX != 0xFFFFFFFFL)
+      throw new RuntimeException("UNSIGNED_HEX");
+    if (java_constants_fold.BIG_SHIFT != 1099511627776L)
+      throw new RuntimeException("BIG_SHIFT");
+    if (Flags.FlagB.swigValue() != 2 || Flags.FlagC.swigValue() != 3 || Flags.FlagAll.swigValue() != 3)
+      throw new RuntimeException("Flags");
+    if (Sizes.Nested.Second.swigValue() != 11 || Sizes.Nested.Third.swigValue() != 4)
+      throw new RuntimeException("Sizes.Nested");
+    if (java_constants_fold.UNSIGNED_WRAP != 1)
+      throw new RuntimeException("UNSIGNED_WRAP");
+    if (java_constants_fold.SIGN_SHIFT != Integer.MIN_VALUE)
+      throw new RuntimeException("SIGN_SHIFT");
+
+    // %javaconst(0) constants obtained from C
+    if (java_constants_fold.RUNTIME_INT != 42)
+      throw new RuntimeException("RUNTIME_INT");
+    if (java_constants_fold.RUNTIME_UINT != 4000000000L)
+      throw new RuntimeException("RUNTIME_UINT");
+    if (java_constants_fold.RUNTIME_LLONG != -1099511627776L)
+      throw new RuntimeException("RUNTIME_LLONG");
+    if (java_constants_fold.RUNTIME_DOUBLE != 2.5)
+      throw new RuntimeException("RUNTIME_DOUBLE");
+    if (java_constants_fold.RUNTIME_FLOAT != 1.5)
+      throw new RuntimeException("RUNTIME_FLOAT");
+    if (!java_constants_fold.RUNTIME_BOOL)
+      throw new RuntimeException("RUNTIME_BOOL");
+    if (!java_constants_fold.RUNTIME_STRING.equals("str"))
+      throw new RuntimeException("RUNTIME_STRING");
+    if (RuntimeEnum.RuntimeB.swigValue() != 4)
+      throw new RuntimeException("RuntimeEnum");
+    if (RuntimeStatics.Member != -5)
+      throw new RuntimeException("RuntimeStatics.Member");
+    if (RuntimeStatics.EnumMember != RuntimeEnum.RuntimeB)
+      throw new RuntimeException("RuntimeStatics.EnumMember");
+  }
+}
@@ -0,0 +1,35 @@
+import java_jnirefs.*;
+import java.math.BigInteger;
+
+public class java_jnirefs_runme {
+
+  static {
+    try {
+	System.loadLibrary("java_jnirefs");
+    } catch (UnsatisfiedLinkError e) {
+      System.err.println("Native code library failed to load. See the chapter on Dynamic Linking Problems in the SWIG Java documentation for help.\n" + e);
+      System.exit(1);
+    }
+  }
+
+  public static void main(String argv[]) {
+    if (java_jnirefs.twice(21).intValue() != 42)
+      throw new RuntimeException("twice failed");
+
+    try {
+      java_jnirefs.twice(null);
+      throw new RuntimeException("twice(null) should have thrown");
+    } catch (NullPointerException e) {
+    }
+
+    if (java_jnirefs.fromfield(12345) != 12345)
+      throw new RuntimeException("fromfield failed");
+
+    if (java_jnirefs.maxint() != Integer.MAX_VALUE)
+      throw new RuntimeException("maxint failed");
+
+    BigInteger big = new BigInteger("18446744073709551615");
+    if (!java_jnirefs.ullround(big).equals(big))
+      throw new RuntimeException("ullround failed");
+  }
+}
@@ -0,0 +1,47 @@
+
+import java_lib_critical.*;
+
+public class java_lib_critical_runme {
+
+  static {
+    try {
+	System.loadLibrary("java_lib_critical");
+    } catch (UnsatisfiedLinkError e) {
+      System.err.println("Native code library failed to load. See the chapter on Dynamic Linking Problems in the SWIG Java documentation for help.\n" + e);
+      System.exit(1);
+    }
+  }
+
+  public static void main(String argv[]) {
+    double[] values = {1.0, 2.0, 3.0};
+    java_lib_critical.scale(values, values.length, 2.0);
+    if (values[0] != 2.0 || values[1] != 4.0 || values[2] != 6.0)
+      throw new RuntimeException("scale failed");
+
+    double[] a = {1.0, 2.0, 3.0};
+    double[] b = {4.0, 5.0, 6.0};
+    if (java_lib_critical.dot(a, b, 3) != 32.0)
+      throw new RuntimeException("dot failed");
+    if (a[0] != 1.0 || b[2] != 6.0)
+      throw new RuntimeException("const arrays modified");
+
+    int[] counts = {1, 2, 3, 4};
+    String s = java_lib_critical.describe("total", counts, counts.length);
+    if (!s.equals("total: 10"))
+      throw new RuntimeException("describe failed: " + s);
+
+    // The check typemap of n throws before the arrays are held
+    try {
+      java_lib_critical.dot(a, b, -1);
+      throw new RuntimeException("dot with negative n did not throw");
+    } catch (IllegalArgumentException e) {
+    }
+
+    // Null arrays
+    try {
+      java_lib_critical.dot(a, null, 3);
+      throw new RuntimeException("dot with null array did not throw");
+    } catch (NullPointerException e) {
+    }
+  }
+}
@@ -0,0 +1,55 @@
+
+import java_std_string_utf8.*;
+
+public class java_std_string_utf8_runme {
+
+  static {
+    try {
+	System.loadLibrary("java_std_string_utf8");
+    } catch (UnsatisfiedLinkError e) {
+      System.err.println("Native code library failed to load. See the chapter on Dynamic Linking Problems in the SWIG Java documentation for help.\n" + e);
+      System.exit(1);
+    }
+  }
+
+  public static void main(String argv[]) throws Throwable
+  {
+    String s = "café € 😀";
+    if (!java_std_string_utf8.echo(s).equals(s))
+      throw new RuntimeException("echo failed");
+    if (!java_std_string_utf8.echo("").equals(""))
+      throw new RuntimeException("echo of empty string failed");
+    if (java_std_string_utf8.length(s) != s.getBytes("UTF-8").length)
+      throw new RuntimeException("string not passed as UTF-8");
+    if (!java_std_string_utf8.concat(s, "!").equals(s + "!"))
+      throw new RuntimeException("concat failed");
+    if (!java_std_string_utf8.with_nul().equals("a\0b"))
+      throw new RuntimeException("embedded NUL not returned");
+    if (java_std_string_utf8.length("a\0b") != 3)
+      throw new RuntimeException("embedded NUL not passed");
+
+    try {
+      java_std_string_utf8.echo(null);
+      throw new RuntimeException("null string not rejected");
+    } catch (NullPointerException e) {
+    }
+
+    Holder h = new Holder();
+    h.setText(s);
+    if (!h.getText().equals(s) || !h.get().equals(s))
+      throw new RuntimeException("Holder failed");
+
+    Greeter g = new Greeter();
+    if (!g.call_greet(s).equals("Hello " + s))
+      throw new RuntimeException("Greeter failed");
+    g = new CustomGreeter();
+    if (!g.call_greet(s).equals("Bonjour " + s))
+      throw new RuntimeException("CustomGreeter failed");
+  }
+}
+
+class CustomGreeter extends Greeter {
+  public String greet(String name) {
+    return "Bonjour " + name;
+  }
+}
@@ -32,5 +32,35 @@ public class li_std_vector_runme {
     if (v4.get(0).getNum() != 12) throw new RuntimeException("v4 test failed");
     if (v5.get(0).getNum() != 34) throw new RuntimeException("v5 test failed");
     if (v6.get(0).getNum() != 56) throw new RuntimeException("v6 test failed");
+
+    // Bulk copying
+    DoubleVector dv = new DoubleVector();
+    dv.fromArray(new double[] {1.5, 2.5, 3.5, 4.5});
+    if (dv.size() != 4 || dv.get(3) != 4.5) throw new RuntimeException("fromArray test failed");
+    double[] da = dv.toArray();
+    if (da.length != 4 || da[0] != 1.5 || da[3] != 4.5) throw new RuntimeException("toArray test failed");
+    dv.setRange(1, new double[] {20.0, 30.0});
+    double[] range = new double[3];
+    dv.getRange(1, range);
+    if (range[0] != 20.0 || range[1] != 30.0 || range[2] != 4.5) throw new RuntimeException("getRange test failed");
+    boolean thrown = false;
+    try {
+      dv.getRange(2, range);
+    } catch (IndexOutOfBoundsException e) {
+      thrown = true;
+    }
+    if (!thrown) throw new RuntimeException("getRange out of range test failed");
+    thrown = false;
+    try {
+      dv.setRange(Integer.MAX_VALUE, new double[] {1.0, 2.0});
+    } catch (IndexOutOfBoundsException e) {
+      thrown = true;
+    }
+    if (!thrown) throw new RuntimeException("setRange overflowing index test failed");
+
+    LongVector lv = new LongVector();
+    lv.fromArray(new int[] {-1, 2, -3});
+    int[] la = lv.toArray();
+    if (la.length != 3 || la[0] != -1 || la[2] != -3) throw new RuntimeException("LongVector toArray test failed");
   }
 }
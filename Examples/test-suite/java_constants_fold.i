@@ -0,0 +1,42 @@
+// This testcase checks the constant values evaluated by SWIG for %javaconst(1),
+// which would not compile as Java code if the C expression was used, and the
+// constants all obtained by a single call for %javaconst(0)
+
+%module java_constants_fold
+
+%javaconst(1);
+
+%inline %{
+#define UNSIGNED_HEX 0xFFFFFFFFU
+#define BIG_SHIFT (1LL << 40)
+#define NEGATIVE (-(2 + 3))
+// Overflows in C, so these are obtained from C instead
+#define UNSIGNED_WRAP (0xFFFFFFFFU + 2U)
+#define SIGN_SHIFT (1 << 31)
+
+enum Flags { FlagA = 0x1U, FlagB = FlagA << 1, FlagC, FlagAll = FlagA | FlagB | FlagC };
+
+struct Sizes {
+  static const unsigned char Bytes = sizeof(unsigned char) * 4;
+  enum Nested { First = 10u, Second, Third = Second % 7 };
+};
+%}
+
+%javaconst(0);
+
+%inline %{
+#define RUNTIME_INT (6 * 7)
+#define RUNTIME_UINT 4000000000U
+#define RUNTIME_LLONG (-1099511627776LL)
+#define RUNTIME_DOUBLE 2.5
+#define RUNTIME_FLOAT 1.5f
+#define RUNTIME_BOOL true
+#define RUNTIME_STRING "str"
+
+enum RuntimeEnum { RuntimeA = 3, RuntimeB };
+
+struct RuntimeStatics {
+  static const short Member = -5;
+  static const RuntimeEnum EnumMember = RuntimeB;
+};
+%}
@@ -0,0 +1,48 @@
+// Tests the $javaclassref, $javamethodref, $javastaticmethodref, $javafieldref and $javastaticfieldref special variables
+
+%module java_jnirefs
+
+// java.lang.Integer to int and back using cached method IDs
+%typemap(jni) int BOXED "jobject"
+%typemap(jtype) int BOXED "Integer"
+%typemap(jstype) int BOXED "Integer"
+%typemap(javain) int BOXED "$javainput"
+%typemap(javaout) int BOXED { return $jnicall; }
+%typemap(in) int BOXED {
+  if (!$input) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null Integer");
+    return $null;
+  }
+  $1 = (int)JCALL2(CallIntMethod, jenv, $input, $javamethodref("java/lang/Integer", "intValue", "()I"));
+}
+%typemap(out) int BOXED {
+  $result = JCALL3(CallStaticObjectMethod, jenv, $javaclassref("java/lang/Integer"), $javastaticmethodref("java/lang/Integer", "valueOf", "(I)Ljava/lang/Integer;"), (jint)$1);
+}
+
+// java.lang.Integer to int using a cached field ID
+%typemap(jni) int FIELD "jobject"
+%typemap(jtype) int FIELD "Integer"
+%typemap(jstype) int FIELD "Integer"
+%typemap(javain) int FIELD "$javainput"
+%typemap(in) int FIELD {
+  if (!$input) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null Integer");
+    return $null;
+  }
+  $1 = (int)JCALL2(GetIntField, jenv, $input, $javafieldref("java/lang/Integer", "value", "I"));
+}
+
+// Cached static field ID
+%typemap(out) int maxint {
+  (void)$1;
+  $result = JCALL2(GetStaticIntField, jenv, $javaclassref("java/lang/Integer"), $javastaticfieldref("java/lang/Integer", "MAX_VALUE", "I"));
+}
+
+%apply int BOXED { int twice };
+
+%inline %{
+int twice(int BOXED) { return BOXED * 2; }
+int fromfield(int FIELD) { return FIELD; }
+int maxint() { return 0; }
+unsigned long long ullround(unsigned long long x) { return x; }
+%}
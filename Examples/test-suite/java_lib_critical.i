@@ -0,0 +1,45 @@
+/* Tests the CRITICAL typemaps in typemaps.i */
+%module java_lib_critical
+
+%include <typemaps.i>
+
+%apply double *CRITICAL { double *values };
+%apply const double *CRITICAL { const double *a, const double *b };
+%apply const int *CRITICAL { const int *counts };
+
+/* A check typemap making a JNI call, which must come before the arrays are held */
+%typemap(check) int n {
+  if ($1 < 0) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaIllegalArgumentException, "n must not be negative");
+    return $null;
+  }
+}
+
+%inline %{
+#include <stdio.h>
+
+void scale(double *values, int n, double factor) {
+  int i;
+  for (i = 0; i < n; ++i)
+    values[i] *= factor;
+}
+
+double dot(const double *a, const double *b, int n) {
+  double sum = 0;
+  int i;
+  for (i = 0; i < n; ++i)
+    sum += a[i] * b[i];
+  return sum;
+}
+
+/* String argument and return value converted with JNI calls */
+const char *describe(const char *label, const int *counts, int n) {
+  static char buffer[64];
+  int total = 0;
+  int i;
+  for (i = 0; i < n; ++i)
+    total += counts[i];
+  sprintf(buffer, "%.20s: %d", label, total);
+  return buffer;
+}
+%}
@@ -0,0 +1,10 @@
+classdef matlab_director_upcall_helper < matlab_director_upcall.Callback
+  methods
+    function self = matlab_director_upcall_helper()
+      self@matlab_director_upcall.Callback();
+    end
+    function r = eval(self, x)
+      r = 2*x;
+    end
+  end
+end
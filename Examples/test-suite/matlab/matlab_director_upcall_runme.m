@@ -0,0 +1,11 @@
+cb = matlab_director_upcall.Callback();
+if (matlab_director_upcall.integrate(cb, 100) ~= 4950)
+  error('integrate(Callback)')
+end
+
+cb = matlab_director_upcall_helper();
+for i=1:2
+  if (matlab_director_upcall.integrate(cb, 100) ~= 9900)
+    error('integrate(matlab_director_upcall_helper)')
+  end
+end
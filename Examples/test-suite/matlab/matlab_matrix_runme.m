@@ -0,0 +1,33 @@
+m = matlab_matrix.make_matrix(3, 4);
+if (~isa(m, 'double') || ~isequal(size(m), [3, 4]) || m(3, 4) ~= 23)
+  error('make_matrix')
+end
+if (matlab_matrix.element(m, 2, 3) ~= 23)
+  error('element')
+end
+
+m = matlab_matrix.make_int_matrix(200, 100);
+if (~isa(m, 'int32') || m(200, 100) ~= 2089)
+  error('make_int_matrix')
+end
+if (matlab_matrix.int_element([1, 2; 3, 4], 1, 0) ~= 3)
+  error('int_element')
+end
+
+r = matlab_matrix.make_ragged();
+if (~iscell(r))
+  error('make_ragged')
+end
+
+a = [1, 2, 3; 4, 5, 6];
+if (matlab_matrix.colmajor_element(a, 1, 2) ~= 6)
+  error('colmajor_element')
+end
+if (matlab_matrix.rowmajor_element(a, 1, 2) ~= 6)
+  error('rowmajor_element')
+end
+
+v = matlab_matrix.matrix_view();
+if (~isequal(size(v), [3, 4]) || v(2, 3) ~= 12)
+  error('matrix_view')
+end
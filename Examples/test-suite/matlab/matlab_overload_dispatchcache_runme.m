@@ -0,0 +1,44 @@
+f = matlab_overload_dispatchcache.Foo();
+b = matlab_overload_dispatchcache.Bar();
+s = matlab_overload_dispatchcache.Spam();
+k = matlab_overload_dispatchcache.Klass();
+
+% Repeat so that the second round goes through the cached overloads
+for i=1:2
+  if (matlab_overload_dispatchcache.over(f) ~= 1)
+    error('over(Foo)')
+  end
+  if (matlab_overload_dispatchcache.over(b) ~= 2)
+    error('over(Bar)')
+  end
+  if (matlab_overload_dispatchcache.over(s) ~= 3)
+    error('over(Spam)')
+  end
+  if (matlab_overload_dispatchcache.over(int32(3)) ~= 4)
+    error('over(int)')
+  end
+  if (matlab_overload_dispatchcache.over(3) ~= 4)
+    error('over(int) with integral double')
+  end
+  if (matlab_overload_dispatchcache.over(3.5) ~= 5)
+    error('over(double)')
+  end
+  if (matlab_overload_dispatchcache.over('hello') ~= 6)
+    error('over(std::string)')
+  end
+  if (matlab_overload_dispatchcache.over(f, 2) ~= 7)
+    error('over(Foo, int)')
+  end
+  if (matlab_overload_dispatchcache.over(b, 2.5) ~= 8)
+    error('over(Foo, double)')
+  end
+  if (k.method(2) ~= 10)
+    error('Klass::method(int)')
+  end
+  if (k.method(2.5) ~= 11)
+    error('Klass::method(double)')
+  end
+  if (k.method(b) ~= 12)
+    error('Klass::method(Foo)')
+  end
+end
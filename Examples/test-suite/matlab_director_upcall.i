@@ -0,0 +1,18 @@
+%module(directors="1") matlab_director_upcall
+
+// C++ code calling an overridden method in a loop, each call is an upcall
+%feature("director") Callback;
+
+%inline %{
+struct Callback {
+  virtual ~Callback() {}
+  virtual double eval(double x) { return x; }
+};
+
+double integrate(Callback *cb, int n) {
+  double sum = 0;
+  for (int i = 0; i < n; ++i)
+    sum += cb->eval(i);
+  return sum;
+}
+%}
@@ -0,0 +1,75 @@
+%module matlab_matrix
+
+%include <matrix.i>
+
+%template(DoubleVector) std::vector<double>;
+%template(DoubleMatrix) std::vector<std::vector<double> >;
+%template(IntVector) std::vector<int>;
+%template(IntMatrix) std::vector<std::vector<int> >;
+%template(LongLongVector) std::vector<long long>;
+%template(LongLongMatrix) std::vector<std::vector<long long> >;
+
+%apply (const double *IN_COLMAJOR, int ROWS, int COLS, int STRIDE) { (const double *a, int m, int n, int lda) };
+%apply (const double *IN_ROWMAJOR, int ROWS, int COLS, int STRIDE) { (const double *b, int rows, int cols, int stride) };
+%apply (const double **ARGOUT_ROWMAJOR, int *ROWS, int *COLS, int *STRIDE) { (const double **data, int *rows, int *cols, int *stride) };
+
+%inline %{
+#include <vector>
+
+// Element (i,j) is 10*i + j
+std::vector<std::vector<double> > make_matrix(int rows, int cols) {
+  std::vector<std::vector<double> > m(rows, std::vector<double>(cols));
+  for (int i = 0; i < rows; ++i)
+    for (int j = 0; j < cols; ++j)
+      m[i][j] = 10*i + j;
+  return m;
+}
+
+std::vector<std::vector<int> > make_int_matrix(int rows, int cols) {
+  std::vector<std::vector<int> > m(rows, std::vector<int>(cols));
+  for (int i = 0; i < rows; ++i)
+    for (int j = 0; j < cols; ++j)
+      m[i][j] = 10*i + j;
+  return m;
+}
+
+std::vector<std::vector<double> > make_ragged() {
+  std::vector<std::vector<double> > m(2);
+  m[0].push_back(1);
+  m[1].push_back(2);
+  m[1].push_back(3);
+  return m;
+}
+
+double element(const std::vector<std::vector<double> > &m, int i, int j) {
+  return m[i][j];
+}
+
+int int_element(const std::vector<std::vector<int> > &m, int i, int j) {
+  return m[i][j];
+}
+
+long long longlong_element(const std::vector<std::vector<long long> > &m, int i, int j) {
+  return m[i][j];
+}
+
+double colmajor_element(const double *a, int m, int n, int lda, int i, int j) {
+  return (i < m && j < n) ? a[i + j*lda] : -1;
+}
+
+double rowmajor_element(const double *b, int rows, int cols, int stride, int i, int j) {
+  return (i < rows && j < cols) ? b[i*stride + j] : -1;
+}
+
+// 3x4 matrix stored row-major with padded rows
+void matrix_view(const double **data, int *rows, int *cols, int *stride) {
+  static double storage[3*5];
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 5; ++j)
+      storage[i*5 + j] = j < 4 ? 10*i + j : -1;
+  *data = storage;
+  *rows = 3;
+  *cols = 4;
+  *stride = 5;
+}
+%}
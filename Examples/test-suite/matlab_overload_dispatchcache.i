@@ -0,0 +1,35 @@
+%module matlab_overload_dispatchcache
+
+// Overload dispatch with the selected overload cached per argument signature
+%feature("matlab:dispatchcache");
+
+%include <std_string.i>
+
+%inline %{
+#include <string>
+
+class Foo {};
+class Bar : public Foo {};
+class Spam {};
+
+int  over(Foo *f) { return 1; }
+int  over(Bar *b) { return 2; }
+int  over(Spam *s) { return 3; }
+int  over(int i) { return 4; }
+int  over(double d) { return 5; }
+int  over(const std::string &s) { return 6; }
+int  over(Foo *f, int i) { return 7; }
+int  over(Foo *f, double d) { return 8; }
+
+// Overloads selected by the range and sign of a numeric argument
+int  range(short s) { return 20; }
+int  range(double d) { return 21; }
+int  sign(unsigned int u) { return 22; }
+int  sign(double d) { return 23; }
+
+struct Klass {
+  int method(int i) { return 10; }
+  int method(double d) { return 11; }
+  int method(Foo *f) { return 12; }
+};
+%}
@@ -50,3 +50,17 @@ mii[1] = 2
 
 if mii[1] != 2:
     raise RuntimeError
+
+# Iteration and conversion in bulk
+mii = li_std_map.IntIntMap()
+for i in range(100):
+    mii[i] = i * i
+if list(mii) != list(range(100)) or list(mii.key_iterator().batched()) != list(range(100)):
+    raise RuntimeError("list(mii)")
+if not isinstance(iter(mii), li_std_map.SwigPyIterator):
+    raise RuntimeError("iter(mii) type")
+d = mii.todict()
+if len(d) != 100 or d[7] != 49 or d != mii.asdict():
+    raise RuntimeError("todict")
+if li_std_map.IntIntMap().todict() != {}:
+    raise RuntimeError("empty todict")
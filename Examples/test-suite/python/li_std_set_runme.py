@@ -90,3 +90,7 @@ for i in s:
 
 if (len(sum) != 3 or (not 1 in sum) or (not 'hello' in sum) or (not (1, 2) in sum)):
     raise RuntimeError
+
+s = set_string(["b", "a"])
+if s.tolist() != ["a", "b"] or list(s) != ["a", "b"]:
+    raise RuntimeError("set tolist")
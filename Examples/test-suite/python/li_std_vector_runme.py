@@ -2,3 +2,44 @@ from li_std_vector import *
 
 if typedef_test(101) != 101:
     raise RuntimeError
+
+import array
+
+# Buffers of the element type are copied, others converted item by item
+if average(array.array('i', [1, 3, 5])) != 3:
+    raise RuntimeError
+if half(array.array('d', [2, 4])) != (1, 2):
+    raise RuntimeError
+if half(array.array('f', [2, 4])) != (1, 2):
+    raise RuntimeError
+if half(array.array('d')) != ():
+    raise RuntimeError
+if list(ULongVector(array.array('L', [1, 2]))) != [1, 2]:
+    raise RuntimeError
+
+try:
+    average(array.array('d', [1.5]))
+    raise RuntimeError("float buffer converted to std::vector<int>")
+except TypeError:
+    pass
+
+if half((2, 4)) != (1, 2):
+    raise RuntimeError
+if half(range(3)) != (0, 0.5, 1):
+    raise RuntimeError
+
+# Iteration, explicitly in batches, and conversion in bulk
+iv = IntVector(range(1000))
+if list(iv) != list(range(1000)) or iv.tolist() != list(range(1000)):
+    raise RuntimeError("IntVector iteration")
+if not isinstance(iter(iv), SwigPyIterator):
+    raise RuntimeError("iter(IntVector) type")
+if list(iv.iterator().batched()) != list(range(1000)):
+    raise RuntimeError("IntVector batched")
+if [x for x in iv if x < 3] != [0, 1, 2]:
+    raise RuntimeError("IntVector comprehension")
+if BoolVector([True, False]).tolist() != [True, False] or IntVector().tolist() != []:
+    raise RuntimeError("tolist")
+it = iv.iterator()
+if it.nextn(3) != [0, 1, 2] or it.next() != 3 or len(it.nextn(2000)) != 996 or it.nextn(5) != []:
+    raise RuntimeError("nextn")
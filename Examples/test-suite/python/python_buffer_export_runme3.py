@@ -0,0 +1,49 @@
+import sys
+from python_buffer_export import *
+
+PyBUF_FULL_RO = 0x11c
+PyBUF_FULL = 0x11d
+
+
+def view(obj, flags=PyBUF_FULL_RO):
+    # Python classes implement the buffer protocol with __buffer__ since 3.12
+    if is_python_builtin() or sys.version_info >= (3, 12):
+        return memoryview(obj)
+    return obj.__buffer__(flags)
+
+v = DoubleVector([1.0, 2.0, 3.0])
+mv = view(v)
+if mv.format != "d" or mv.shape != (3,) or mv.readonly:
+    raise RuntimeError("vector buffer")
+if mv.tolist() != [1.0, 2.0, 3.0]:
+    raise RuntimeError("vector buffer contents")
+mv[1] = 5.0
+if v[1] != 5.0:
+    raise RuntimeError("vector buffer is not a view")
+
+# The view keeps the vector alive
+del v
+if mv.tolist() != [1.0, 5.0, 3.0]:
+    raise RuntimeError("vector buffer lifetime")
+mv.release()
+
+if view(IntVector([4, 5])).tolist() != [4, 5] or view(IntVector([4, 5])).format != "i":
+    raise RuntimeError("int vector buffer")
+if len(view(DoubleVector())) != 0:
+    raise RuntimeError("empty vector buffer")
+
+m = Matrix(2, 3)
+mv = view(m)
+if mv.shape != (2, 3) or mv.strides != (24, 8) or mv.tolist() != [[0.0, 1.0, 2.0], [3.0, 4.0, 5.0]]:
+    raise RuntimeError("matrix buffer")
+
+c = m.column(1)
+mv = view(c)
+if not mv.readonly or mv.strides != (24,) or mv.tolist() != [1.0, 4.0]:
+    raise RuntimeError("column buffer")
+if not is_python_builtin() and sys.version_info < (3, 12):
+    try:
+        c.__buffer__(PyBUF_FULL)
+        raise RuntimeError("column buffer is writable")
+    except BufferError:
+        pass
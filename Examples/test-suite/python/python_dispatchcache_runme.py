@@ -0,0 +1,59 @@
+from python_dispatchcache import *
+
+def check(got, expected):
+    if got != expected:
+        raise RuntimeError("got '%s', expected '%s'" % (got, expected))
+
+# Each call is repeated so that the second one is served from the cache
+for i in range(2):
+    check(over(1), "short")
+    check(over(-1), "short")
+    check(over(40000), "long long")
+    check(over(-40000), "long long")
+    check(over(1 << 40), "long long")
+    check(over(1 << 70), "double")
+    check(over(1.5), "double")
+    check(over("a"), "const char *")
+    check(over(Foo()), "Foo *")
+    check(over(Bar()), "Bar *")
+    check(over(Spam()), "Spam *")
+    check(none(None), "Foo *")
+
+    check(narrow(255), "unsigned char")
+    check(narrow(256), "float")
+    check(narrow(-1), "float")
+    check(narrow(2.5), "float")
+    check(narrow(Foo(), 1), "Foo *, int")
+    check(narrow(Bar(), 1), "Foo *, int")
+
+    check(precision(1.5), "float")
+    check(precision(1e300), "double")
+    check(precision(float("inf")), "float")
+    check(precision(-1e300), "double")
+    check(precision(float("-inf")), "float")
+
+    check(text("a"), "char")
+    check(text("ab"), "const char *")
+    check(text(""), "char")
+
+    o = Overloads()
+    check(o.call(1), "int")
+    check(o.call(1, 2), "int, int")
+    check(o.call(Foo()), "const Foo &")
+    check(Overloads.scall(True), "bool")
+    check(Overloads.scall(1.0), "double")
+
+# Calls that are not cached still fail, the last overload raises its own error with -fastdispatch
+for i in range(2):
+    try:
+        over([])
+    except (NotImplementedError, TypeError):
+        pass
+    else:
+        raise RuntimeError("over([]) accepted")
+    try:
+        narrow(1e300)
+    except (NotImplementedError, OverflowError):
+        pass
+    else:
+        raise RuntimeError("narrow(1e300) accepted")
@@ -0,0 +1,42 @@
+from python_fastcall import *
+
+
+def check_raises(exc, f, *args, **kwargs):
+    try:
+        f(*args, **kwargs)
+    except exc:
+        return
+    raise RuntimeError("%s not raised by %s" % (exc.__name__, f.__name__))
+
+if sum3(1, 2, 3) != 6:
+    raise RuntimeError("sum3")
+check_raises(TypeError, sum3, 1, 2)
+check_raises(TypeError, sum3, 1, 2, 3, 4)
+
+if sum_default(1) != 111 or sum_default(1, 2) != 103 or sum_default(1, 2, 3) != 6:
+    raise RuntimeError("sum_default")
+
+if kw_sum(1) != 123 or kw_sum(1, 5) != 153:
+    raise RuntimeError("kw_sum positional")
+if kw_sum(a=1, c=7) != 127 or kw_sum(4, c=5, b=6) != 465:
+    raise RuntimeError("kw_sum keywords")
+check_raises(TypeError, kw_sum, b=1)
+check_raises(TypeError, kw_sum, 1, a=2)
+check_raises(TypeError, kw_sum, 1, d=2)
+check_raises(TypeError, kw_sum, 1, 2, 3, 4)
+
+if over(1) != 1 or over(1, 2) != 2 or over("x", 1, 2) != 3:
+    raise RuntimeError("over")
+check_raises(NotImplementedError, over)
+check_raises(NotImplementedError, over, 1, 2, 3)
+
+a = Adder(1000)
+if a.add(1, 2) != 1003:
+    raise RuntimeError("add")
+check_raises(TypeError, a.add, 1)
+if a.add_kw(2) != 1020 or a.add_kw(2, b=3) != 1023 or a.add_kw(b=3, a=4) != 1043:
+    raise RuntimeError("add_kw")
+if a.add_over(1) != 1001 or a.add_over(3, 4) != 1012:
+    raise RuntimeError("add_over")
+if Adder.twice(1, 2) != 6 or a.twice(2, 3) != 10:
+    raise RuntimeError("twice")
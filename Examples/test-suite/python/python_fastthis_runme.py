@@ -0,0 +1,62 @@
+from python_fastthis import *
+import _python_fastthis
+
+# SwigPyThis is missing with -builtin, where the objects are the wrappers
+fastthis = hasattr(_python_fastthis, "SwigPyThis")
+
+b = Base()
+d = Derived()
+if value_of(b) != 1 or value_of(d) != 2 or value_of(new_derived()) != 2:
+    raise RuntimeError("value_of")
+
+# 'this' is held by the common base, not in the instance dictionary
+if fastthis and not isinstance(b, _python_fastthis.SwigPyThis):
+    raise RuntimeError("SwigPyThis")
+if "this" in getattr(b, "__dict__", {}):
+    raise RuntimeError("this in __dict__")
+if not b.thisown:
+    raise RuntimeError("thisown")
+
+# Returned pointers are built directly, without an instance dictionary
+r = new_derived()
+if not isinstance(r, Base) or r.get() != 2:
+    raise RuntimeError("new_derived")
+if "this" in getattr(r, "__dict__", {}):
+    raise RuntimeError("returned this in __dict__")
+for i in range(1000):
+    if new_derived().this.own():
+        raise RuntimeError("new_derived owned")
+
+# Several wrapped bases share the same slot
+both = Both()
+if value_of(both) != 4 or other_of(both) != 3:
+    raise RuntimeError("Both")
+
+
+class Extended(Derived):
+
+    def __init__(self):
+        Derived.__init__(self)
+        self.extra = 6
+
+e = Extended()
+if value_of(e) != 2 or e.extra != 6 or e.__dict__ != {"extra": 6}:
+    raise RuntimeError("Extended")
+
+f = Fixed()
+if f.x != 5:
+    raise RuntimeError("Fixed")
+try:
+    f.y = 1
+    raise RuntimeError("Fixed is not nondynamic")
+except AttributeError:
+    pass
+
+# An object without 'this' is not a wrapped object
+if fastthis:
+    u = Base.__new__(Base)
+    try:
+        value_of(u)
+        raise RuntimeError("object without 'this' accepted")
+    except TypeError:
+        pass
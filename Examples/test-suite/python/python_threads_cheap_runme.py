@@ -0,0 +1,28 @@
+from python_threads_cheap import *
+
+c = Counter()
+c.count = 1
+c.slow()
+c.slow_inline()
+c.twice()
+marked_cheap(1)
+for i in range(3):
+    released(i)
+
+stats = SWIG_PyThreadStats(True)
+
+# Accessors, inline functions and %feature("nothreadallow_cheap") keep the GIL
+for name in ["Counter_count_get", "Counter_count_set", "new_Counter", "Counter_twice", "marked_cheap"]:
+    if name in stats:
+        raise RuntimeError(name + " released the GIL")
+
+for name, releases in [("Counter_slow", 1), ("Counter_slow_inline", 1), ("released", 3)]:
+    if name not in stats:
+        raise RuntimeError(name + " did not release the GIL")
+    count, histogram = stats[name]
+    if count != releases or sum(histogram) != releases or len(histogram) != 6:
+        raise RuntimeError("%s: %s" % (name, stats[name]))
+
+# Reset by the call above
+if SWIG_PyThreadStats()["released"] != (0, (0, 0, 0, 0, 0, 0)):
+    raise RuntimeError("reset")
@@ -0,0 +1,20 @@
+from python_threads_stats import *
+
+custom_begin(1)
+custom_end(1)
+overloaded(1)
+overloaded(1.5)
+overloaded(1, 2)
+overloaded(3, 4)
+
+stats = SWIG_PyThreadStats()
+
+# Custom thread allow code is not counted
+for name in ["custom_begin", "custom_end"]:
+    if name in stats:
+        raise RuntimeError(name + " was counted")
+
+# The overloads are counted together
+count, histogram = stats["overloaded"]
+if count != 4 or sum(histogram) != 4:
+    raise RuntimeError("overloaded: %s" % (stats["overloaded"],))
@@ -0,0 +1,23 @@
+import type_query_a
+import type_query_b
+
+def check(got, expected):
+    if got != expected:
+        raise RuntimeError("got '%s', expected '%s'" % (got, expected))
+
+# Twice, the second time with the index built by the first lookups
+for i in range(2):
+    check(type_query_b.query("_p_Alpha"), "_p_Alpha")
+    check(type_query_b.query("_p_Beta"), "_p_Beta")
+    check(type_query_b.query("Alpha *"), "_p_Alpha")
+    check(type_query_b.query("Alpha*"), "_p_Alpha")
+    check(type_query_b.query("Alpha  *"), "_p_Alpha")
+    check(type_query_b.query("AlphaAlias *"), "_p_Alpha")
+    check(type_query_b.query("Beta *"), "_p_Beta")
+    check(type_query_b.query("Gamma *"), "")
+    check(type_query_b.query(""), "")
+
+    check(type_query_b.mangled_query("_p_Alpha"), "_p_Alpha")
+    check(type_query_b.mangled_query("_p_Beta"), "_p_Beta")
+    check(type_query_b.mangled_query("Alpha *"), "")
+    check(type_query_b.mangled_query("_p_Gamma"), "")
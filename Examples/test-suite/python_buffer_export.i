@@ -0,0 +1,55 @@
+%module python_buffer_export
+
+%include <pybuffer.i>
+%include <std_vector.i>
+
+%pybuffer_export_vector(double)
+%pybuffer_export_vector(int)
+%template(DoubleVector) std::vector<double>;
+%template(IntVector) std::vector<int>;
+
+%pybuffer_export(Matrix, double, 2, self_->data(),
+                 (self_->rows(), self_->cols()),
+                 (self_->cols() * sizeof(double), sizeof(double)));
+
+// A column of a matrix, strided and read-only
+%pybuffer_export_readonly(Column, double, 1, self_->data(),
+                          (self_->size()),
+                          (self_->stride() * sizeof(double)));
+
+%inline %{
+#ifdef SWIGPYTHON_BUILTIN
+bool is_python_builtin() { return true; }
+#else
+bool is_python_builtin() { return false; }
+#endif
+
+class Column;
+
+class Matrix {
+  int rows_, cols_;
+  std::vector<double> data_;
+public:
+  Matrix(int rows, int cols) : rows_(rows), cols_(cols), data_(rows * cols) {
+    for (int i = 0; i < rows * cols; ++i)
+      data_[i] = i;
+  }
+  int rows() const { return rows_; }
+  int cols() const { return cols_; }
+  const double *data() const { return &data_[0]; }
+  double get(int i, int j) const { return data_[i * cols_ + j]; }
+  Column column(int j) const;
+};
+
+class Column {
+  const double *data_;
+  int size_, stride_;
+public:
+  Column(const double *data, int size, int stride) : data_(data), size_(size), stride_(stride) {}
+  const double *data() const { return data_; }
+  int size() const { return size_; }
+  int stride() const { return stride_; }
+};
+
+Column Matrix::column(int j) const { return Column(data() + j, rows_, cols_); }
+%}
@@ -0,0 +1,44 @@
+%module python_dispatchcache
+
+// Overloads selected through the dispatch cache, this test is run with -dispatchcache
+
+%inline %{
+struct Foo {
+  int foo() const { return 1; }
+};
+
+struct Bar : Foo {
+};
+
+struct Spam {
+};
+
+const char *over(short) { return "short"; }
+const char *over(long long) { return "long long"; }
+const char *over(double) { return "double"; }
+const char *over(const char *) { return "const char *"; }
+const char *over(Foo *) { return "Foo *"; }
+const char *over(Bar *) { return "Bar *"; }
+const char *over(Spam *) { return "Spam *"; }
+
+const char *none(int) { return "int"; }
+const char *none(Foo *) { return "Foo *"; }
+
+const char *narrow(unsigned char) { return "unsigned char"; }
+const char *narrow(float) { return "float"; }
+const char *narrow(Foo *, int) { return "Foo *, int"; }
+
+const char *precision(float) { return "float"; }
+const char *precision(double) { return "double"; }
+
+const char *text(char) { return "char"; }
+const char *text(const char *) { return "const char *"; }
+
+struct Overloads {
+  const char *call(int) { return "int"; }
+  const char *call(int, int) { return "int, int"; }
+  const char *call(const Foo &) { return "const Foo &"; }
+  static const char *scall(bool) { return "bool"; }
+  static const char *scall(double) { return "double"; }
+};
+%}
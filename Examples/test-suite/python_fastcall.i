@@ -0,0 +1,26 @@
+%module python_fastcall
+
+// Wrappers using the METH_FASTCALL calling convention, this test is run with -fastcall
+
+%feature("kwargs") kw_sum;
+%feature("kwargs") Adder::add_kw;
+
+%inline %{
+int sum3(int a, int b, int c) { return a + b + c; }
+int sum_default(int a, int b = 10, int c = 100) { return a + b + c; }
+int kw_sum(int a, int b = 2, int c = 3) { return 100*a + 10*b + c; }
+
+int over(int) { return 1; }
+int over(int, int) { return 2; }
+int over(const char *, int, int) { return 3; }
+
+struct Adder {
+  int base;
+  Adder(int base) : base(base) {}
+  int add(int a, int b) const { return base + a + b; }
+  int add_kw(int a, int b = 0) const { return base + 10*a + b; }
+  int add_over(int a) const { return base + a; }
+  int add_over(int a, int b) const { return base + a*b; }
+  static int twice(int a, int b) { return 2*(a + b); }
+};
+%}
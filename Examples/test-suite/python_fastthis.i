@@ -0,0 +1,35 @@
+%module python_fastthis
+
+// Proxy classes holding 'this' in a slot of the SwigPyThis base, this test is run with -fastthis
+
+%pythonnondynamic Fixed;
+
+%inline %{
+struct Base {
+  int value;
+  Base(int value = 1) : value(value) {}
+  virtual ~Base() {}
+  int get() const { return value; }
+};
+
+struct Derived : Base {
+  Derived() : Base(2) {}
+};
+
+struct Other {
+  int other() const { return 3; }
+};
+
+struct Both : Base, Other {
+  Both() : Base(4) {}
+};
+
+struct Fixed {
+  int x;
+  Fixed() : x(5) {}
+};
+
+int value_of(const Base &b) { return b.value; }
+int other_of(const Other *o) { return o->other(); }
+Base *new_derived() { return new Derived(); }
+%}
@@ -0,0 +1,32 @@
+%module python_threads_cheap
+
+// GIL release policy and statistics, this test is run with -threads -cheapthreads
+
+%begin %{
+#define SWIG_PYTHON_THREAD_STATS
+%}
+
+%feature("nothreadallow_cheap") marked_cheap;
+%feature("nothreadallow_cheap", "0") Counter::slow_inline;
+
+%inline %{
+struct Counter {
+  int count;
+  Counter() : count(0) {}
+  int slow_inline() { return ++count; }
+  int slow();
+};
+
+int marked_cheap(int x);
+int released(int x);
+%}
+
+%{
+int Counter::slow() { return ++count; }
+int marked_cheap(int x) { return x; }
+int released(int x) { return x; }
+%}
+
+%extend Counter {
+  int twice() { return 2 * $self->count; }
+}
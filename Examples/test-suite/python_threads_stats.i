@@ -0,0 +1,18 @@
+%module python_threads_stats
+
+// GIL release statistics with custom thread allow code and overloads, this test is run with -threads
+
+%begin %{
+#define SWIG_PYTHON_THREAD_STATS
+%}
+
+%feature("threadbeginallow") custom_begin "SWIG_PYTHON_THREAD_BEGIN_ALLOW;"
+%feature("threadendallow") custom_end "SWIG_PYTHON_THREAD_END_ALLOW;"
+
+%inline %{
+int custom_begin(int x) { return x; }
+int custom_end(int x) { return x; }
+int overloaded(int x) { return x; }
+int overloaded(double x) { return (int)x; }
+int overloaded(int x, int y) { return x + y; }
+%}
@@ -0,0 +1,4 @@
+struct Alpha {
+  int value;
+};
+typedef Alpha AlphaAlias;
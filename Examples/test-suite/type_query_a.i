@@ -0,0 +1,13 @@
+/* Types looked up by name from the type_query_b module */
+
+%module type_query_a
+
+%{
+#include "type_query_a.h"
+%}
+
+%include "type_query_a.h"
+
+%inline %{
+AlphaAlias *alias_alpha(AlphaAlias *a) { return a; }
+%}
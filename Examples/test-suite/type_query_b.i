@@ -0,0 +1,40 @@
+/* Look up types of this module and of the imported type_query_a module
+   with SWIG_TypeQueryModule and SWIG_MangledTypeQueryModule */
+
+%module type_query_b
+
+%{
+#include "type_query_a.h"
+%}
+
+%import "type_query_a.i"
+
+%inline %{
+struct Beta {
+  Alpha *alpha;
+};
+
+/* Mangled name of the type with the given name, "" if not found */
+const char *query(const char *name) {
+#ifdef SWIGPYTHON
+  swig_module_info *module = SWIG_GetModule(0);
+  swig_type_info *ty = SWIG_TypeQueryModule(module, module, name);
+  return ty ? ty->name : "";
+#else
+  (void)name;
+  return "";
+#endif
+}
+
+/* Same for a mangled name only */
+const char *mangled_query(const char *name) {
+#ifdef SWIGPYTHON
+  swig_module_info *module = SWIG_GetModule(0);
+  swig_type_info *ty = SWIG_MangledTypeQueryModule(module, module, name);
+  return ty ? ty->name : "";
+#else
+  (void)name;
+  return "";
+#endif
+}
+%}
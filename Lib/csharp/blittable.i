@@ -0,0 +1,71 @@
+/* -----------------------------------------------------------------------------
+ * blittable.i
+ *
+ * SWIG blittable struct feature and typemaps implementation providing:
+ *   %cs_blittable
+ *
+ * The C# type for a blittable struct is a C# struct with sequential layout
+ * holding a copy of the C/C++ data members, instead of a proxy class. It is
+ * passed by value directly through P/Invoke, so that no native memory nor
+ * managed proxy is allocated. The struct must be standard layout, without
+ * base classes or virtual methods, and its data members must be of the
+ * primitive types having the same size in C# (not bool, char or long),
+ * pointers or other blittable structs. Only the data members are wrapped.
+ *
+ *   %include <blittable.i>
+ *   %cs_blittable(Vec3)
+ *   struct Vec3 { float x, y, z; };
+ *   Vec3 cross(Vec3 a, const Vec3 &b);
+ *   void normalize(Vec3 *v);
+ *
+ * Values and const references are passed by value, pointers and other
+ * references by ref, so a null pointer cannot be passed from C#. All are
+ * returned by value: a returned pointer or reference is copied, so changing
+ * the returned C# struct does not change the C/C++ memory, and a returned
+ * null pointer raises a NullReferenceException.
+ * ----------------------------------------------------------------------------- */
+
+%define %cs_blittable(TYPE...)
+%feature("cs:blittable") TYPE;
+
+%typemap(ctype) TYPE, const TYPE & "TYPE"
+%typemap(imtype) TYPE, const TYPE & "$csclassname"
+%typemap(cstype) TYPE, const TYPE & "$csclassname"
+%typemap(in) TYPE %{ $1 = $input; %}
+%typemap(in) const TYPE & %{ $1 = &$input; %}
+%typemap(out, null="TYPE()") TYPE %{ $result = $1; %}
+%typemap(out, null="TYPE()") const TYPE & %{ $result = *$1; %}
+%typemap(csin) TYPE, const TYPE & "$csinput"
+%typemap(csout, excode=SWIGEXCODE) TYPE, const TYPE & {
+    $csclassname ret = $imcall;$excode
+    return ret;
+  }
+%typemap(csvarout, excode=SWIGEXCODE2) TYPE, const TYPE & %{
+    get {
+      $csclassname ret = $imcall;$excode
+      return ret;
+    } %}
+
+%typemap(ctype, out="TYPE") TYPE *, const TYPE *, TYPE & "TYPE *"
+%typemap(imtype, out="$csclassname") TYPE *, const TYPE *, TYPE & "ref $csclassname"
+%typemap(cstype, out="$csclassname") TYPE *, const TYPE *, TYPE & "ref $csclassname"
+%typemap(in) TYPE *, const TYPE *, TYPE & %{ $1 = $input; %}
+%typemap(out, null="TYPE()") TYPE & %{ $result = *$1; %}
+%typemap(out, null="TYPE()", canthrow=1) TYPE *, const TYPE * %{
+  if (!$1) {
+    SWIG_CSharpSetPendingException(SWIG_CSharpNullReferenceException, "TYPE pointer is null");
+    return $null;
+  }
+  $result = *$1;
+%}
+%typemap(csin) TYPE *, const TYPE *, TYPE & "ref $csinput"
+%typemap(csout, excode=SWIGEXCODE) TYPE *, const TYPE *, TYPE & {
+    $csclassname ret = $imcall;$excode
+    return ret;
+  }
+%typemap(csvarout, excode=SWIGEXCODE2) TYPE *, const TYPE *, TYPE & %{
+    get {
+      $csclassname ret = $imcall;$excode
+      return ret;
+    } %}
+%enddef
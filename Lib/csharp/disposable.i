@@ -0,0 +1,160 @@
+/* -----------------------------------------------------------------------------
+ * disposable.i
+ *
+ * SWIG lightweight ownership mode for C# proxy classes providing:
+ *   %cs_disposable
+ *   SWIGTYPE *HANDLE, SWIGTYPE &HANDLE typemaps
+ *
+ * By default, a proxy class owning its C++ object has a finalizer deleting the
+ * C++ object should Dispose() not have been called. Every such proxy goes
+ * through the finalization queue, which becomes a GC bottleneck when millions
+ * of short-lived objects are created. The proxy classes of the types passed to
+ * %cs_disposable have no finalizer and the C++ object is only deleted by
+ * Dispose(), which must be called by the user, e.g. with a using statement.
+ * Disposing the same object from several threads at once is not supported.
+ *
+ *   %include <disposable.i>
+ *   %cs_disposable(Particle)
+ *
+ *   using (Particle p = new Particle()) {
+ *     ...
+ *   }
+ *
+ * The proxy classes also get a nested Handle struct holding the C++ pointer
+ * only, which is used instead of the proxy class for pointers and references
+ * named HANDLE. These do not own the C++ object and allocate nothing on the
+ * managed heap, so they are well suited for borrowed references returned by
+ * accessors, for example:
+ *
+ *   %apply SWIGTYPE *HANDLE { Particle *particle, Particle *Emitter::get }
+ *   struct Emitter {
+ *     Particle *get(int i);
+ *   };
+ *   void update(Particle *particle);
+ *
+ *   Particle.Handle h = emitter.get(0);
+ *   update(h);
+ *   Particle p = h.ToObject(); // Non-owning proxy class object
+ *
+ * The Handle of a derived class converts implicitly to the Handle of its base
+ * class. The HANDLE typemaps can only be used for types passed to
+ * %cs_disposable, which must also be used for the base classes of these.
+ * As with SWIG_CSBODY_PROXY, use SWIG_CSBODY_DISPOSABLE instead to change the
+ * visibility of the pointer constructor and getCPtr, e.g. to public when
+ * using multiple modules.
+ * ----------------------------------------------------------------------------- */
+
+%define SWIG_CSBODY_DISPOSABLE(PTRCTOR_VISIBILITY, CPTR_VISIBILITY, TYPE...)
+%typemap(csbody) TYPE %{
+  private global::System.Runtime.InteropServices.HandleRef swigCPtr;
+  protected bool swigCMemOwn;
+
+  PTRCTOR_VISIBILITY $csclassname(global::System.IntPtr cPtr, bool cMemoryOwn) {
+    swigCMemOwn = cMemoryOwn;
+    swigCPtr = new global::System.Runtime.InteropServices.HandleRef(this, cPtr);
+  }
+
+  CPTR_VISIBILITY static global::System.Runtime.InteropServices.HandleRef getCPtr($csclassname obj) {
+    return (obj == null) ? new global::System.Runtime.InteropServices.HandleRef(null, global::System.IntPtr.Zero) : obj.swigCPtr;
+  }
+
+  public struct Handle {
+    CPTR_VISIBILITY readonly global::System.IntPtr swigCPtr;
+
+    CPTR_VISIBILITY Handle(global::System.IntPtr cPtr) {
+      swigCPtr = cPtr;
+    }
+
+    public bool IsNull {
+      get { return swigCPtr == global::System.IntPtr.Zero; }
+    }
+
+    public $csclassname ToObject() {
+      return IsNull ? null : new $csclassname(swigCPtr, false);
+    }
+  }
+
+  public Handle GetHandle() {
+    return new Handle(swigCPtr.Handle);
+  }
+%}
+
+%typemap(csbody_derived) TYPE %{
+  private global::System.Runtime.InteropServices.HandleRef swigCPtr;
+
+  PTRCTOR_VISIBILITY $csclassname(global::System.IntPtr cPtr, bool cMemoryOwn) : base($imclassname.$csclazznameSWIGUpcast(cPtr), cMemoryOwn) {
+    swigCPtr = new global::System.Runtime.InteropServices.HandleRef(this, cPtr);
+  }
+
+  CPTR_VISIBILITY static global::System.Runtime.InteropServices.HandleRef getCPtr($csclassname obj) {
+    return (obj == null) ? new global::System.Runtime.InteropServices.HandleRef(null, global::System.IntPtr.Zero) : obj.swigCPtr;
+  }
+
+  public new struct Handle {
+    CPTR_VISIBILITY readonly global::System.IntPtr swigCPtr;
+
+    CPTR_VISIBILITY Handle(global::System.IntPtr cPtr) {
+      swigCPtr = cPtr;
+    }
+
+    public bool IsNull {
+      get { return swigCPtr == global::System.IntPtr.Zero; }
+    }
+
+    public $csclassname ToObject() {
+      return IsNull ? null : new $csclassname(swigCPtr, false);
+    }
+
+    public static implicit operator $csbaseclassname.Handle(Handle handle) {
+      return new $csbaseclassname.Handle($imclassname.$csclazznameSWIGUpcast(handle.swigCPtr));
+    }
+  }
+
+  public new Handle GetHandle() {
+    return new Handle(swigCPtr.Handle);
+  }
+%}
+
+%typemap(csfinalize) TYPE ""
+
+%typemap(csdestruct, methodname="Dispose", methodmodifiers="public") TYPE {
+    if (swigCPtr.Handle != global::System.IntPtr.Zero) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        $imcall;
+      }
+      swigCPtr = new global::System.Runtime.InteropServices.HandleRef(null, global::System.IntPtr.Zero);
+    }
+  }
+
+%typemap(csdestruct_derived, methodname="Dispose", methodmodifiers="public") TYPE {
+    if (swigCPtr.Handle != global::System.IntPtr.Zero) {
+      if (swigCMemOwn) {
+        swigCMemOwn = false;
+        $imcall;
+      }
+      swigCPtr = new global::System.Runtime.InteropServices.HandleRef(null, global::System.IntPtr.Zero);
+    }
+    base.Dispose();
+  }
+%enddef
+
+%define %cs_disposable(TYPE...)
+SWIG_CSBODY_DISPOSABLE(internal, internal, TYPE)
+%enddef
+
+%typemap(cstype, out="$csclassname.Handle") SWIGTYPE *HANDLE, SWIGTYPE &HANDLE "$csclassname.Handle"
+%typemap(csin) SWIGTYPE *HANDLE, SWIGTYPE &HANDLE "new global::System.Runtime.InteropServices.HandleRef(null, $csinput.swigCPtr)"
+%typemap(csout, excode=SWIGEXCODE) SWIGTYPE *HANDLE, SWIGTYPE &HANDLE {
+    $csclassname.Handle ret = new $csclassname.Handle($imcall);$excode
+    return ret;
+  }
+%typemap(csvarin, excode=SWIGEXCODE2) SWIGTYPE *HANDLE, SWIGTYPE &HANDLE %{
+    set {
+      $imcall;$excode
+    } %}
+%typemap(csvarout, excode=SWIGEXCODE2) SWIGTYPE *HANDLE, SWIGTYPE &HANDLE %{
+    get {
+      $csclassname.Handle ret = new $csclassname.Handle($imcall);$excode
+      return ret;
+    } %}
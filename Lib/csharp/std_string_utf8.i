@@ -0,0 +1,224 @@
+/* -----------------------------------------------------------------------------
+ * std_string_utf8.i
+ *
+ * Typemaps for std::string and const std::string& mapped to a C# String, like
+ * std_string.i, but marshalled as UTF-8 through reusable buffers instead of
+ * the default P/Invoke string marshalling and SWIGStringHelper callback.
+ *
+ * A string returned to C# is passed as a pointer to the UTF-8 data and its
+ * length, and decoded directly by the managed side. A const std::string&
+ * return points at the C++ string itself, a std::string returned by value is
+ * moved into a per-thread C++ buffer. A string passed to C++ is encoded into
+ * per-thread pinned managed buffers, which are reused by every call. Apart
+ * from the C# string returned, no memory is allocated per call, the strings
+ * can contain embedded NUL characters and are always UTF-8 encoded.
+ *
+ *   %include <std_string_utf8.i>
+ *   std::string greet(const std::string &name);
+ *
+ * These typemaps replace those of std_string.i. The C# strings are decoded
+ * with Marshal.PtrToStringUTF8 when NETCOREAPP or NETSTANDARD2_1_OR_GREATER is
+ * defined, otherwise through a per-thread byte array.
+ *
+ * To use non-const std::string references use the following %apply. Note
+ * that they are passed by value.
+ * %apply const std::string & {std::string &};
+ * ----------------------------------------------------------------------------- */
+
+%include <std_string.i>
+
+%fragment("SWIG_CSharpStringUtf8", "header") %{
+#include <string>
+
+/* UTF-8 string passed between C# and C++, matching SWIGStringUtf8 in C#. */
+typedef struct {
+  const char *data;
+  int length;
+} SWIG_CSharpStringUtf8;
+
+#if defined(__cplusplus) && (__cplusplus >= 201103L || (defined(_MSC_VER) && _MSC_VER >= 1900))
+static std::string &SWIG_CSharpStringUtf8Buffer() {
+  static thread_local std::string buffer;
+  return buffer;
+}
+#else
+#if defined(_MSC_VER)
+#define SWIG_CSHARP_THREAD_LOCAL __declspec(thread)
+#else
+#define SWIG_CSHARP_THREAD_LOCAL __thread
+#endif
+/* Allocated once per thread and never freed. */
+static std::string &SWIG_CSharpStringUtf8Buffer() {
+  static SWIG_CSHARP_THREAD_LOCAL std::string *buffer = 0;
+  if (!buffer)
+    buffer = new std::string();
+  return *buffer;
+}
+#endif
+
+static SWIG_CSharpStringUtf8 SWIG_CSharpStringUtf8Make(const std::string &s) {
+  SWIG_CSharpStringUtf8 result;
+  result.data = s.data();
+  result.length = (int)s.size();
+  return result;
+}
+
+/* Keeps the returned string alive until the next string returned to C# by
+ * the calling thread. */
+static SWIG_CSharpStringUtf8 SWIG_CSharpStringUtf8Return(std::string &s) {
+  std::string &buffer = SWIG_CSharpStringUtf8Buffer();
+  buffer.swap(s);
+  return SWIG_CSharpStringUtf8Make(buffer);
+}
+%}
+
+// Public as it is also used by the director delegates
+%pragma(csharp) modulecode=%{
+  [global::System.Runtime.InteropServices.StructLayout(global::System.Runtime.InteropServices.LayoutKind.Sequential)]
+  public struct SWIGStringUtf8 {
+    public global::System.IntPtr data;
+    public int length;
+  }
+%}
+
+%pragma(csharp) imclasscode=%{
+  public class SWIGStringUtf8Helper {
+    private class PinnedBuffer {
+      private byte[] array;
+      private global::System.Runtime.InteropServices.GCHandle handle;
+
+      public $module.SWIGStringUtf8 Encode(string s) {
+        $module.SWIGStringUtf8 result = new $module.SWIGStringUtf8();
+        if (s == null)
+          return result;
+        int size = global::System.Text.Encoding.UTF8.GetMaxByteCount(s.Length);
+        if (array == null || array.Length < size) {
+          if (handle.IsAllocated)
+            handle.Free();
+          array = new byte[size < 256 ? 256 : size];
+          handle = global::System.Runtime.InteropServices.GCHandle.Alloc(array, global::System.Runtime.InteropServices.GCHandleType.Pinned);
+        }
+        result.data = handle.AddrOfPinnedObject();
+        result.length = global::System.Text.Encoding.UTF8.GetBytes(s, 0, s.Length, array, 0);
+        return result;
+      }
+
+      ~PinnedBuffer() {
+        if (handle.IsAllocated)
+          handle.Free();
+      }
+    }
+
+    // Per-thread buffers, freed by the PinnedBuffer finalizers once the thread has exited
+    [global::System.ThreadStatic] private static PinnedBuffer[] argumentBuffers;
+    [global::System.ThreadStatic] private static int argumentDepth;
+    [global::System.ThreadStatic] private static PinnedBuffer returnBuffer;
+#if !(NETCOREAPP || NETSTANDARD2_1_OR_GREATER)
+    [global::System.ThreadStatic] private static byte[] decodeBuffer;
+#endif
+
+    public static string Decode($module.SWIGStringUtf8 s) {
+      if (s.length == 0)
+        return "";
+#if NETCOREAPP || NETSTANDARD2_1_OR_GREATER
+      return global::System.Runtime.InteropServices.Marshal.PtrToStringUTF8(s.data, s.length);
+#else
+      if (decodeBuffer == null || decodeBuffer.Length < s.length)
+        decodeBuffer = new byte[s.length < 256 ? 256 : s.length];
+      global::System.Runtime.InteropServices.Marshal.Copy(s.data, decodeBuffer, 0, s.length);
+      return global::System.Text.Encoding.UTF8.GetString(decodeBuffer, 0, s.length);
+#endif
+    }
+
+    // Encodes a string argument into the next free buffer of the calling thread,
+    // which is in use until the matching Release()
+    public static $module.SWIGStringUtf8 Acquire(string s) {
+      if (argumentBuffers == null)
+        argumentBuffers = new PinnedBuffer[4];
+      if (argumentDepth == argumentBuffers.Length)
+        global::System.Array.Resize(ref argumentBuffers, argumentDepth * 2);
+      PinnedBuffer buffer = argumentBuffers[argumentDepth];
+      if (buffer == null)
+        argumentBuffers[argumentDepth] = buffer = new PinnedBuffer();
+      argumentDepth++;
+      return buffer.Encode(s);
+    }
+
+    public static void Release() {
+      if (argumentDepth > 0)
+        argumentDepth--;
+    }
+
+    // Encodes a string returned by a director method, which C++ copies straight away
+    public static $module.SWIGStringUtf8 Return(string s) {
+      if (returnBuffer == null)
+        returnBuffer = new PinnedBuffer();
+      return returnBuffer.Encode(s);
+    }
+  }
+%}
+
+namespace std {
+
+%typemap(ctype, null="SWIG_CSharpStringUtf8()", fragment="SWIG_CSharpStringUtf8") string, const string & "SWIG_CSharpStringUtf8"
+%typemap(imtype) string, const string & "$module.SWIGStringUtf8"
+%typemap(cstype) string, const string & "string"
+
+%typemap(csdirectorin) string, const string & "$imclassname.SWIGStringUtf8Helper.Decode($iminput)"
+%typemap(csdirectorout) string, const string & "$imclassname.SWIGStringUtf8Helper.Return($cscall)"
+
+%typemap(in, canthrow=1) string
+%{ if (!$input.data) {
+    SWIG_CSharpSetPendingExceptionArgument(SWIG_CSharpArgumentNullException, "null string", 0);
+    return $null;
+   }
+   $1.assign($input.data, (size_t)$input.length); %}
+%typemap(in, canthrow=1) const string &
+%{ if (!$input.data) {
+    SWIG_CSharpSetPendingExceptionArgument(SWIG_CSharpArgumentNullException, "null string", 0);
+    return $null;
+   }
+   $*1_ltype $1_str($input.data, (size_t)$input.length);
+   $1 = &$1_str; %}
+
+%typemap(out, null="SWIG_CSharpStringUtf8()") string %{ $result = SWIG_CSharpStringUtf8Return($1); %}
+%typemap(out, null="SWIG_CSharpStringUtf8()") const string & %{ $result = SWIG_CSharpStringUtf8Make(*$1); %}
+
+%typemap(directorout, canthrow=1) string
+%{ if (!$input.data) {
+    SWIG_CSharpSetPendingExceptionArgument(SWIG_CSharpArgumentNullException, "null string", 0);
+    return $null;
+   }
+   $result.assign($input.data, (size_t)$input.length); %}
+%typemap(directorout, canthrow=1, warning=SWIGWARN_TYPEMAP_THREAD_UNSAFE_MSG) const string &
+%{ if (!$input.data) {
+    SWIG_CSharpSetPendingExceptionArgument(SWIG_CSharpArgumentNullException, "null string", 0);
+    return $null;
+   }
+   /* possible thread/reentrant code problem */
+   static $*1_ltype $1_str;
+   $1_str.assign($input.data, (size_t)$input.length);
+   $result = &$1_str; %}
+
+%typemap(directorin) string, const string & %{ $input = SWIG_CSharpStringUtf8Make($1); %}
+
+%typemap(csin, post="      $imclassname.SWIGStringUtf8Helper.Release();") string, const string & "$imclassname.SWIGStringUtf8Helper.Acquire($csinput)"
+%typemap(csout, excode=SWIGEXCODE) string, const string & {
+    string ret = $imclassname.SWIGStringUtf8Helper.Decode($imcall);$excode
+    return ret;
+  }
+%typemap(csvarin, excode=SWIGEXCODE2) const string & %{
+    set {
+      try {
+        $imcall;$excode
+      } finally {
+        $imclassname.SWIGStringUtf8Helper.Release();
+      }
+    } %}
+%typemap(csvarout, excode=SWIGEXCODE2) const string & %{
+    get {
+      string ret = $imclassname.SWIGStringUtf8Helper.Decode($imcall);$excode
+      return ret;
+    } %}
+
+}
@@ -102,10 +102,16 @@
       throw new global::System.ArgumentException("Multi dimensional array.", "array");
     if (index+count > this.Count || arrayIndex+count > array.Length)
       throw new global::System.ArgumentException("Number of elements to copy is too large.");
-    for (int i=0; i<count; i++)
-      array.SetValue(getitemcopy(index+i), arrayIndex+i);
+    $typemap(csvectorcopyto, CTYPE)
   }
 
+  public $typemap(cstype, CTYPE)[] ToArray() {
+    $typemap(cstype, CTYPE)[] array = new $typemap(cstype, CTYPE)[this.Count];
+    this.CopyTo(array);
+    return array;
+  }
+$typemap(csvectorcode, CTYPE)
+
   global::System.Collections.Generic.IEnumerator<$typemap(cstype, CTYPE)> global::System.Collections.Generic.IEnumerable<$typemap(cstype, CTYPE)>.GetEnumerator() {
     return new $csclassnameEnumerator(this);
   }
@@ -331,6 +337,60 @@
     }
 %enddef
 
+// Extra methods added to the collection class if the elements are blittable, that is,
+// CSTYPE has the same representation as CTYPE. Elements are then copied to and from
+// C# arrays in a single call, rather than one call per element.
+%define SWIG_STD_VECTOR_EXTRA_BLITTABLE(CSTYPE, CTYPE...)
+%typemap(ctype)   CTYPE *SWIG_VECTOR_BUFFER "CTYPE *"
+%typemap(cstype)  CTYPE *SWIG_VECTOR_BUFFER "CSTYPE[]"
+%typemap(imtype, inattributes="[global::System.Runtime.InteropServices.In, global::System.Runtime.InteropServices.Out, global::System.Runtime.InteropServices.MarshalAs(global::System.Runtime.InteropServices.UnmanagedType.LPArray)]") CTYPE *SWIG_VECTOR_BUFFER "CSTYPE[]"
+%typemap(csin)    CTYPE *SWIG_VECTOR_BUFFER "$csinput"
+%typemap(in)      CTYPE *SWIG_VECTOR_BUFFER "$1 = $input;"
+
+%typemap(ctype)   const CTYPE *SWIG_VECTOR_BUFFER "CTYPE *"
+%typemap(cstype)  const CTYPE *SWIG_VECTOR_BUFFER "CSTYPE[]"
+%typemap(imtype, inattributes="[global::System.Runtime.InteropServices.In, global::System.Runtime.InteropServices.MarshalAs(global::System.Runtime.InteropServices.UnmanagedType.LPArray)]") const CTYPE *SWIG_VECTOR_BUFFER "CSTYPE[]"
+%typemap(csin)    const CTYPE *SWIG_VECTOR_BUFFER "$csinput"
+%typemap(in)      const CTYPE *SWIG_VECTOR_BUFFER "$1 = $input;"
+
+%typemap(csvectorcopyto) CTYPE "copyitemsto(index, array, arrayIndex, count);"
+%typemap(csvectorcode) CTYPE %{
+  public static $typemap(cstype, std::vector< CTYPE >) FromArray(CSTYPE[] values) {
+    $typemap(cstype, std::vector< CTYPE >) vector = new $typemap(cstype, std::vector< CTYPE >)();
+    vector.AddArray(values);
+    return vector;
+  }
+
+  public void AddArray(CSTYPE[] values) {
+    if (values == null)
+      throw new global::System.ArgumentNullException("values");
+    additemsfrom(values, values.Length);
+  }
+
+  public void SetArray(int index, CSTYPE[] values) {
+    if (values == null)
+      throw new global::System.ArgumentNullException("values");
+    setitemsfrom(index, values, values.Length);
+  }
+%}
+
+    %extend {
+      void copyitemsto(int index, CTYPE *SWIG_VECTOR_BUFFER, int arrayIndex, int count) {
+        std::copy($self->begin()+index, $self->begin()+index+count, SWIG_VECTOR_BUFFER+arrayIndex);
+      }
+      void additemsfrom(const CTYPE *SWIG_VECTOR_BUFFER, int count) {
+        $self->insert($self->end(), SWIG_VECTOR_BUFFER, SWIG_VECTOR_BUFFER+count);
+      }
+      void setitemsfrom(int index, const CTYPE *SWIG_VECTOR_BUFFER, int count) throw (std::out_of_range) {
+        if (index < 0)
+          throw std::out_of_range("index");
+        if (index > (int)$self->size() || count > (int)$self->size() - index)
+          throw std::out_of_range("index");
+        std::copy(SWIG_VECTOR_BUFFER, SWIG_VECTOR_BUFFER+count, $self->begin()+index);
+      }
+    }
+%enddef
+
 // Macros for std::vector class specializations/enhancements
 %define SWIG_STD_VECTOR_ENHANCED(CTYPE...)
 namespace std {
@@ -341,6 +401,16 @@ namespace std {
 }
 %enddef
 
+%define SWIG_STD_VECTOR_BLITTABLE(CSTYPE, CTYPE...)
+namespace std {
+  template<> class vector< CTYPE > {
+    SWIG_STD_VECTOR_MINIMUM_INTERNAL(IList, %arg(CTYPE const&), %arg(CTYPE))
+    SWIG_STD_VECTOR_EXTRA_OP_EQUALS_EQUALS(CTYPE)
+    SWIG_STD_VECTOR_EXTRA_BLITTABLE(CSTYPE, CTYPE)
+  };
+}
+%enddef
+
 // Legacy macros
 %define SWIG_STD_VECTOR_SPECIALIZE(CSTYPE, CTYPE...)
 #warning SWIG_STD_VECTOR_SPECIALIZE macro deprecated, please see csharp/std_vector.i and switch to SWIG_STD_VECTOR_ENHANCED
@@ -363,6 +433,13 @@ SWIG_STD_VECTOR_ENHANCED(CTYPE)
 %csmethodmodifiers std::vector::size "private"
 %csmethodmodifiers std::vector::capacity "private"
 %csmethodmodifiers std::vector::reserve "private"
+%csmethodmodifiers std::vector::copyitemsto "private"
+%csmethodmodifiers std::vector::additemsfrom "private"
+%csmethodmodifiers std::vector::setitemsfrom "private"
+
+// Element copying in CopyTo and extra members, replaced for blittable element types
+%typemap(csvectorcopyto) SWIGTYPE "for (int i=0; i<count; i++)\n      array.SetValue(getitemcopy(index+i), arrayIndex+i);"
+%typemap(csvectorcode) SWIGTYPE ""
 
 namespace std {
   // primary (unspecialized) class template for std::vector
@@ -384,18 +461,20 @@ namespace std {
 
 // template specializations for std::vector
 // these provide extra collections methods as operator== is defined
+// and, for the blittable types, bulk copying to and from C# arrays
 SWIG_STD_VECTOR_ENHANCED(char)
-SWIG_STD_VECTOR_ENHANCED(signed char)
-SWIG_STD_VECTOR_ENHANCED(unsigned char)
-SWIG_STD_VECTOR_ENHANCED(short)
-SWIG_STD_VECTOR_ENHANCED(unsigned short)
-SWIG_STD_VECTOR_ENHANCED(int)
-SWIG_STD_VECTOR_ENHANCED(unsigned int)
+SWIG_STD_VECTOR_BLITTABLE(sbyte, signed char)
+SWIG_STD_VECTOR_BLITTABLE(byte, unsigned char)
+SWIG_STD_VECTOR_BLITTABLE(short, short)
+SWIG_STD_VECTOR_BLITTABLE(ushort, unsigned short)
+SWIG_STD_VECTOR_BLITTABLE(int, int)
+SWIG_STD_VECTOR_BLITTABLE(uint, unsigned int)
+// long is 8 bytes on Unix 64 bit but maps to the 4 byte int
 SWIG_STD_VECTOR_ENHANCED(long)
 SWIG_STD_VECTOR_ENHANCED(unsigned long)
-SWIG_STD_VECTOR_ENHANCED(long long)
-SWIG_STD_VECTOR_ENHANCED(unsigned long long)
-SWIG_STD_VECTOR_ENHANCED(float)
-SWIG_STD_VECTOR_ENHANCED(double)
+SWIG_STD_VECTOR_BLITTABLE(long, long long)
+SWIG_STD_VECTOR_BLITTABLE(ulong, unsigned long long)
+SWIG_STD_VECTOR_BLITTABLE(float, float)
+SWIG_STD_VECTOR_BLITTABLE(double, double)
 SWIG_STD_VECTOR_ENHANCED(std::string) // also requires a %include <std_string.i>
 
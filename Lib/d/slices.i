@@ -0,0 +1,83 @@
+/* -----------------------------------------------------------------------------
+ * slices.i
+ *
+ * Typemaps for passing C arrays and strings as D slices which borrow the C/C++
+ * memory instead of copying it to or from the GC heap. None of them allocate,
+ * so functions using them can be wrapped as »nothrow @nogc« using
+ * %feature("d:nogc"). Requires D2.
+ *
+ *   (TYPE *SLICE, size_t LENGTH)        - scope TYPE[] parameter
+ *   (const TYPE *SLICE, size_t LENGTH)  - scope const(TYPE)[] parameter
+ *   (const char *STRING, size_t LENGTH) - scope const(char)[] parameter
+ *   const char *BORROWED                - const(char)[] return value
+ *
+ * The parameter slices are only valid for the duration of the call, the C/C++
+ * code must not keep a reference to them. The returned slice points into the
+ * C/C++ string and is only valid as long as the string is.
+ *
+ * For example:
+ *
+ *   %include <slices.i>
+ *   %apply (const double *SLICE, size_t LENGTH) { (const double *values, size_t count) }
+ *   %apply const char *BORROWED { const char *label }
+ *   double sum(const double *values, size_t count);
+ *   const char *label();
+ *
+ * is wrapped as
+ *
+ *   double sum(scope const(double)[] values);
+ *   const(char)[] label();
+ * ----------------------------------------------------------------------------- */
+
+#if (SWIG_D_VERSION == 1)
+#error "slices.i requires D2."
+#endif
+
+%fragment("SWIG_DSlice", "header") %{
+/* Memory layout of a D slice (dynamic array). */
+typedef struct {
+  size_t length;
+  void *ptr;
+} SWIG_DSlice;
+%}
+
+%pragma(d) globalproxyimports = "static import core.stdc.string;";
+
+%define %d_slice_typemaps(TYPE, DTYPE)
+%typemap(ctype) (TYPE *SLICE, size_t LENGTH), (const TYPE *SLICE, size_t LENGTH) "const SWIG_DSlice *"
+%typemap(imtype) (TYPE *SLICE, size_t LENGTH) "DTYPE[]*"
+%typemap(imtype) (const TYPE *SLICE, size_t LENGTH) "const(DTYPE)[]*"
+%typemap(dtype, nogc="1", inattributes="scope ") (TYPE *SLICE, size_t LENGTH) "DTYPE[]"
+%typemap(dtype, nogc="1", inattributes="scope ") (const TYPE *SLICE, size_t LENGTH) "const(DTYPE)[]"
+
+%typemap(in, fragment="SWIG_DSlice") (TYPE *SLICE, size_t LENGTH), (const TYPE *SLICE, size_t LENGTH) %{
+  $1 = ($1_ltype)$input->ptr;
+  $2 = ($2_ltype)$input->length;
+%}
+%typemap(din) (TYPE *SLICE, size_t LENGTH), (const TYPE *SLICE, size_t LENGTH) "&$dinput"
+
+%typecheck(SWIG_TYPECHECK_POINTER) (TYPE *SLICE, size_t LENGTH), (const TYPE *SLICE, size_t LENGTH) ""
+%enddef
+
+%d_slice_typemaps(char, char)
+%d_slice_typemaps(signed char, byte)
+%d_slice_typemaps(unsigned char, ubyte)
+%d_slice_typemaps(short, short)
+%d_slice_typemaps(unsigned short, ushort)
+%d_slice_typemaps(int, int)
+%d_slice_typemaps(unsigned int, uint)
+%d_slice_typemaps(long long, long)
+%d_slice_typemaps(unsigned long long, ulong)
+%d_slice_typemaps(float, float)
+%d_slice_typemaps(double, double)
+
+%apply (const char *SLICE, size_t LENGTH) { (const char *STRING, size_t LENGTH) }
+
+%typemap(ctype) const char *BORROWED "const char *"
+%typemap(imtype) const char *BORROWED "const(char)*"
+%typemap(dtype, nogc="1") const char *BORROWED "const(char)[]"
+%typemap(out) const char *BORROWED %{ $result = $1; %}
+%typemap(dout, excode=SWIGEXCODE) const char *BORROWED {
+  const(char)* ret = $imcall;$excode
+  return ret ? ret[0 .. core.stdc.string.strlen(ret)] : null;
+}
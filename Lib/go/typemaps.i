@@ -296,3 +296,63 @@ INOUT_TYPEMAP(float, float32);
 INOUT_TYPEMAP(double, float64);
 
 #undef INOUT_TYPEMAP
+
+/*
+SLICE typemaps
+--------------
+
+These typemaps pass a Go slice to a C pointer and length pair without
+copying it.  The C/C++ function is given a pointer into the Go memory,
+so it may read and, for a non-const pointer, modify the elements, but it
+must not keep the pointer after it returns.
+
+        (bool               *SLICE, size_t LENGTH)
+        (signed char        *SLICE, size_t LENGTH)
+        (unsigned char      *SLICE, size_t LENGTH)
+        (short              *SLICE, size_t LENGTH)
+        (unsigned short     *SLICE, size_t LENGTH)
+        (int                *SLICE, size_t LENGTH)
+        (unsigned int       *SLICE, size_t LENGTH)
+        (long long          *SLICE, size_t LENGTH)
+        (unsigned long long *SLICE, size_t LENGTH)
+        (float              *SLICE, size_t LENGTH)
+        (double             *SLICE, size_t LENGTH)
+
+and the same with a const pointer.  The Go element type has the same
+size as the C type, so int is []int32, not []int.  The length may be of
+any integer type when the typemaps are applied, for example:
+
+        %include <typemaps.i>
+        %apply (const double *SLICE, size_t LENGTH) { (const double *samples, int count) };
+        double mean(const double *samples, int count);
+
+In Go you could then use it like this:
+        m := modulename.Mean([]float64{1, 2, 3})
+
+Strings can be passed without copying in the same way with the
+(char *STRING, size_t LENGTH) typemaps.
+*/
+
+%define SLICE_TYPEMAP(TYPE, GOTYPE)
+%typemap(gotype) (TYPE *SLICE, size_t LENGTH), (const TYPE *SLICE, size_t LENGTH) %{[]GOTYPE%}
+
+%typemap(in) (TYPE *SLICE, size_t LENGTH), (const TYPE *SLICE, size_t LENGTH)
+%{
+  $1 = ($1_ltype)$input.array;
+  $2 = ($2_ltype)$input.len;
+%}
+%enddef
+
+SLICE_TYPEMAP(bool, bool);
+SLICE_TYPEMAP(signed char, int8);
+SLICE_TYPEMAP(unsigned char, byte);
+SLICE_TYPEMAP(short, int16);
+SLICE_TYPEMAP(unsigned short, uint16);
+SLICE_TYPEMAP(int, int32);
+SLICE_TYPEMAP(unsigned int, uint32);
+SLICE_TYPEMAP(long long, int64);
+SLICE_TYPEMAP(unsigned long long, uint64);
+SLICE_TYPEMAP(float, float32);
+SLICE_TYPEMAP(double, float64);
+
+#undef SLICE_TYPEMAP
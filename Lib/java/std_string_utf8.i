@@ -0,0 +1,111 @@
+/* -----------------------------------------------------------------------------
+ * std_string_utf8.i
+ *
+ * Typemaps for std::string and const std::string& mapped to a Java String, like
+ * std_string.i, but transferred as UTF-8 byte arrays instead of using
+ * NewStringUTF and GetStringUTFChars.
+ *
+ * The JNI string functions use modified UTF-8, which encodes NUL and the
+ * characters outside the Basic Multilingual Plane differently to standard
+ * UTF-8, and GetStringUTFChars allocates a copy of the string on every call.
+ * These typemaps encode and decode the strings in Java with the UTF-8
+ * charset instead and the C++ code copies the bytes directly from or into
+ * the Java byte array, so the strings are standard UTF-8 and can contain
+ * embedded NUL characters.
+ *
+ *   %include <std_string_utf8.i>
+ *   std::string greet(const std::string &name);
+ *
+ * These typemaps replace those of std_string.i and require Java 7 or later.
+ *
+ * To use non-const std::string references use the following %apply. Note
+ * that they are passed by value.
+ * %apply const std::string & {std::string &};
+ * ----------------------------------------------------------------------------- */
+
+%include <std_string.i>
+
+%fragment("SWIG_JavaStringUtf8", "header") %{
+#include <string>
+
+static jbyteArray SWIG_JavaStringUtf8New(JNIEnv *jenv, const std::string &s) {
+  jsize length = (jsize)s.size();
+  jbyteArray result = jenv->NewByteArray(length);
+  if (result && length)
+    jenv->SetByteArrayRegion(result, 0, length, (const jbyte *)s.data());
+  return result;
+}
+
+static void SWIG_JavaStringUtf8Assign(JNIEnv *jenv, jbyteArray bytes, std::string &s) {
+  jsize length = jenv->GetArrayLength(bytes);
+  s.resize((size_t)length);
+  if (length)
+    jenv->GetByteArrayRegion(bytes, 0, length, (jbyte *)&s[0]);
+}
+%}
+
+%pragma(java) jniclasscode=%{
+  public static byte[] SWIGStringUtf8Encode(String s) {
+    return s == null ? null : s.getBytes(java.nio.charset.StandardCharsets.UTF_8);
+  }
+%}
+
+namespace std {
+
+%typemap(jni) string, const string & "jbyteArray"
+%typemap(jtype) string, const string & "byte[]"
+%typemap(jstype) string, const string & "String"
+%typemap(javadirectorin) string, const string & "new String($jniinput, java.nio.charset.StandardCharsets.UTF_8)"
+%typemap(javadirectorout) string, const string & "SWIGStringUtf8Encode($javacall)"
+
+%typemap(in, fragment="SWIG_JavaStringUtf8") string
+%{ if(!$input) {
+     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+     return $null;
+   }
+   SWIG_JavaStringUtf8Assign(jenv, $input, $1); %}
+
+%typemap(in, fragment="SWIG_JavaStringUtf8") const string &
+%{ if(!$input) {
+     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+     return $null;
+   }
+   $*1_ltype $1_str;
+   SWIG_JavaStringUtf8Assign(jenv, $input, $1_str);
+   $1 = &$1_str; %}
+
+%typemap(directorout, fragment="SWIG_JavaStringUtf8") string
+%{ if(!$input) {
+     if (!jenv->ExceptionCheck()) {
+       SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+     }
+     return $null;
+   }
+   SWIG_JavaStringUtf8Assign(jenv, $input, $result); %}
+
+%typemap(directorout, fragment="SWIG_JavaStringUtf8", warning=SWIGWARN_TYPEMAP_THREAD_UNSAFE_MSG) const string &
+%{ if(!$input) {
+     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "null string");
+     return $null;
+   }
+   /* possible thread/reentrant code problem */
+   static $*1_ltype $1_str;
+   SWIG_JavaStringUtf8Assign(jenv, $input, $1_str);
+   $result = &$1_str; %}
+
+%typemap(directorin, descriptor="[B", fragment="SWIG_JavaStringUtf8") string, const string &
+%{ $input = SWIG_JavaStringUtf8New(jenv, $1);
+   Swig::LocalRefGuard $1_refguard(jenv, $input); %}
+
+%typemap(out, fragment="SWIG_JavaStringUtf8") string
+%{ $result = SWIG_JavaStringUtf8New(jenv, $1); %}
+%typemap(out, fragment="SWIG_JavaStringUtf8") const string &
+%{ $result = SWIG_JavaStringUtf8New(jenv, *$1); %}
+
+%typemap(javain) string, const string & "$imclassname.SWIGStringUtf8Encode($javainput)"
+
+%typemap(javaout) string, const string & {
+    return new String($jnicall, java.nio.charset.StandardCharsets.UTF_8);
+  }
+
+}
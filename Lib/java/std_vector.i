@@ -7,8 +7,34 @@
 %{
 #include <vector>
 #include <stdexcept>
+#include <algorithm>
+
+/* Copy between the elements of a std::vector and a region of a Java array in a single JNI call.
+   The elements are converted through a temporary buffer when the JNI type has a different size. */
+template <class A, class J, class T>
+static void SWIG_JavaVectorToRegion(JNIEnv *jenv, void (JNIEnv::*set)(A, jsize, jsize, const J *), A array, jsize start, jsize len, const T *first) {
+  if (sizeof(J) == sizeof(T)) {
+    (jenv->*set)(array, start, len, (const J *)first);
+  } else {
+    std::vector<J> buffer(first, first + len);
+    (jenv->*set)(array, start, len, &buffer[0]);
+  }
+}
+
+template <class A, class J, class T>
+static void SWIG_JavaVectorFromRegion(JNIEnv *jenv, void (JNIEnv::*get)(A, jsize, jsize, J *), A array, jsize start, jsize len, T *first) {
+  if (sizeof(J) == sizeof(T)) {
+    (jenv->*get)(array, start, len, (J *)first);
+  } else {
+    std::vector<J> buffer(len);
+    (jenv->*get)(array, start, len, &buffer[0]);
+    std::copy(buffer.begin(), buffer.end(), first);
+  }
+}
 %}
 
+%typemap(in, numinputs=0) JNIEnv *SWIG_JNIENV "$1 = jenv;"
+
 namespace std {
     
     template<class T> class vector {
@@ -79,6 +105,97 @@ namespace std {
     };
 }
 
+// Specializations for the primitive types, which add methods copying all or a range of
+// the elements to and from a Java array in a single call
+%define SWIG_STD_VECTOR_JAVA_ARRAY(CTYPE, JNITYPE, JNINAME)
+namespace std {
+    template<> class vector<CTYPE> {
+      public:
+        typedef size_t size_type;
+        typedef CTYPE value_type;
+        typedef const value_type& const_reference;
+        vector();
+        vector(size_type n);
+        size_type size() const;
+        size_type capacity() const;
+        void reserve(size_type n);
+        %rename(isEmpty) empty;
+        bool empty() const;
+        void clear();
+        %rename(add) push_back;
+        void push_back(const value_type& x);
+        %extend {
+            const_reference get(int i) throw (std::out_of_range) {
+                int size = int(self->size());
+                if (i>=0 && i<size)
+                    return (*self)[i];
+                else
+                    throw std::out_of_range("vector index out of range");
+            }
+            void set(int i, const value_type& val) throw (std::out_of_range) {
+                int size = int(self->size());
+                if (i>=0 && i<size)
+                    (*self)[i] = val;
+                else
+                    throw std::out_of_range("vector index out of range");
+            }
+            JNITYPE##Array toArray(JNIEnv *SWIG_JNIENV) {
+                jsize size = jsize(self->size());
+                JNITYPE##Array array = SWIG_JNIENV->New##JNINAME##Array(size);
+                if (array && size)
+                    SWIG_JavaVectorToRegion(SWIG_JNIENV, &JNIEnv::Set##JNINAME##ArrayRegion, array, 0, size, &(*self)[0]);
+                return array;
+            }
+            void fromArray(JNIEnv *SWIG_JNIENV, JNITYPE##Array values) {
+                if (!values) {
+                    SWIG_JavaThrowException(SWIG_JNIENV, SWIG_JavaNullPointerException, "null array");
+                    return;
+                }
+                jsize size = SWIG_JNIENV->GetArrayLength(values);
+                self->resize(size);
+                if (size)
+                    SWIG_JavaVectorFromRegion(SWIG_JNIENV, &JNIEnv::Get##JNINAME##ArrayRegion, values, 0, size, &(*self)[0]);
+            }
+            void getRange(JNIEnv *SWIG_JNIENV, int i, JNITYPE##Array array) throw (std::out_of_range) {
+                if (!array) {
+                    SWIG_JavaThrowException(SWIG_JNIENV, SWIG_JavaNullPointerException, "null array");
+                    return;
+                }
+                jsize len = SWIG_JNIENV->GetArrayLength(array);
+                if (i<0 || i>int(self->size()) || len>int(self->size())-i)
+                    throw std::out_of_range("vector index out of range");
+                if (len)
+                    SWIG_JavaVectorToRegion(SWIG_JNIENV, &JNIEnv::Set##JNINAME##ArrayRegion, array, 0, len, &(*self)[i]);
+            }
+            void setRange(JNIEnv *SWIG_JNIENV, int i, JNITYPE##Array values) throw (std::out_of_range) {
+                if (!values) {
+                    SWIG_JavaThrowException(SWIG_JNIENV, SWIG_JavaNullPointerException, "null array");
+                    return;
+                }
+                jsize len = SWIG_JNIENV->GetArrayLength(values);
+                if (i<0 || i>int(self->size()) || len>int(self->size())-i)
+                    throw std::out_of_range("vector index out of range");
+                if (len)
+                    SWIG_JavaVectorFromRegion(SWIG_JNIENV, &JNIEnv::Get##JNINAME##ArrayRegion, values, 0, len, &(*self)[i]);
+            }
+        }
+    };
+}
+%enddef
+
+SWIG_STD_VECTOR_JAVA_ARRAY(char, jchar, Char)
+SWIG_STD_VECTOR_JAVA_ARRAY(signed char, jbyte, Byte)
+SWIG_STD_VECTOR_JAVA_ARRAY(unsigned char, jshort, Short)
+SWIG_STD_VECTOR_JAVA_ARRAY(short, jshort, Short)
+SWIG_STD_VECTOR_JAVA_ARRAY(unsigned short, jint, Int)
+SWIG_STD_VECTOR_JAVA_ARRAY(int, jint, Int)
+SWIG_STD_VECTOR_JAVA_ARRAY(unsigned int, jlong, Long)
+SWIG_STD_VECTOR_JAVA_ARRAY(long, jint, Int)
+SWIG_STD_VECTOR_JAVA_ARRAY(unsigned long, jlong, Long)
+SWIG_STD_VECTOR_JAVA_ARRAY(long long, jlong, Long)
+SWIG_STD_VECTOR_JAVA_ARRAY(float, jfloat, Float)
+SWIG_STD_VECTOR_JAVA_ARRAY(double, jdouble, Double)
+
 %define specialize_std_vector(T)
 #warning "specialize_std_vector - specialization for type T no longer needed"
 %enddef
@@ -92,7 +92,6 @@ INPUT_TYPEMAP(double, jdouble, double, "D");
 /* Convert from BigInteger using the toByteArray member function */
 /* Overrides the typemap in the INPUT_TYPEMAP macro */
 %typemap(in) unsigned long long *INPUT($*1_ltype temp), unsigned long long &INPUT($*1_ltype temp) {
-  jclass clazz;
   jmethodID mid;
   jbyteArray ba;
   jbyte* bae;
@@ -103,8 +102,7 @@ INPUT_TYPEMAP(double, jdouble, double, "D");
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "BigInteger null");
     return $null;
   }
-  clazz = JCALL1(GetObjectClass, jenv, $input);
-  mid = JCALL3(GetMethodID, jenv, clazz, "toByteArray", "()[B");
+  mid = $javamethodref("java/math/BigInteger", "toByteArray", "()[B");
   ba = (jbyteArray)JCALL2(CallObjectMethod, jenv, $input, mid);
   bae = JCALL2(GetByteArrayElements, jenv, ba, 0);
   sz = JCALL1(GetArrayLength, jenv, ba);
@@ -250,8 +248,8 @@ OUTPUT_TYPEMAP(double, jdouble, double, Double, "[Ljava/lang/Double;", jdoubleAr
 %typemap(argout) unsigned long long *OUTPUT, unsigned long long &OUTPUT { 
   jbyteArray ba = JCALL1(NewByteArray, jenv, 9);
   jbyte* bae = JCALL2(GetByteArrayElements, jenv, ba, 0);
-  jclass clazz = JCALL1(FindClass, jenv, "java/math/BigInteger");
-  jmethodID mid = JCALL3(GetMethodID, jenv, clazz, "<init>", "([B)V");
+  jclass clazz = $javaclassref("java/math/BigInteger");
+  jmethodID mid = $javamethodref("java/math/BigInteger", "<init>", "([B)V");
   jobject bigint;
   int i;
 
@@ -393,7 +391,6 @@ INOUT_TYPEMAP(double, jdouble, double, Double, "[Ljava/lang/Double;", jdoubleArr
 /* Override the typemap in the INOUT_TYPEMAP macro for unsigned long long */
 %typemap(in) unsigned long long *INOUT ($*1_ltype temp), unsigned long long &INOUT ($*1_ltype temp) { 
   jobject bigint;
-  jclass clazz;
   jmethodID mid;
   jbyteArray ba;
   jbyte* bae;
@@ -413,8 +410,7 @@ INOUT_TYPEMAP(double, jdouble, double, Double, "[Ljava/lang/Double;", jdoubleArr
     SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "array element null");
     return $null;
   }
-  clazz = JCALL1(GetObjectClass, jenv, bigint);
-  mid = JCALL3(GetMethodID, jenv, clazz, "toByteArray", "()[B");
+  mid = $javamethodref("java/math/BigInteger", "toByteArray", "()[B");
   ba = (jbyteArray)JCALL2(CallObjectMethod, jenv, bigint, mid);
   bae = JCALL2(GetByteArrayElements, jenv, ba, 0);
   sz = JCALL1(GetArrayLength, jenv, ba);
@@ -431,3 +427,80 @@ INOUT_TYPEMAP(double, jdouble, double, Double, "[Ljava/lang/Double;", jdoubleArr
 
 %typemap(argout) unsigned long long *INOUT = unsigned long long *OUTPUT;
 %typemap(argout) unsigned long long &INOUT = unsigned long long &OUTPUT;
+
+
+/*
+CRITICAL typemaps
+-----------------
+
+The CRITICAL typemaps pass a Java primitive array to a C pointer without copying
+it whenever the JVM can pin the array, using GetPrimitiveArrayCritical instead of
+Get<Type>ArrayElements, which copies the whole array on most JVMs. They are meant
+for short calls on large arrays, as the JVM may suspend garbage collection until
+the call returns. The arrays are only accessed once all the other arguments have
+been converted and checked, and are released straight after the wrapped function
+returns, before the return value is converted, as no JNI call is allowed while
+an array is held. The wrapped function must therefore not block, call back into
+Java or throw. Warning 827 is issued if %exception or a throws typemap is used
+with the function, as they would return without releasing the arrays.
+
+        %include <typemaps.i>
+        %apply double *CRITICAL { double *samples };
+        %apply const double *CRITICAL { const double *samples };
+        void scale(double *samples, int n, double factor);
+        double sum(const double *samples, int n);
+
+The array passed in is changed in place when the pointer is not const; it is
+never copied back when the pointer is const. Only the primitive types with the
+same size in Java and C are supported:
+
+      signed char, short, int, long long, float, double
+*/
+
+%define CRITICAL_TYPEMAP(TYPE, JNITYPE, JTYPE, TYPECHECKTYPE)
+%typemap(jni) TYPE *CRITICAL, TYPE CRITICAL[], const TYPE *CRITICAL, const TYPE CRITICAL[] %{JNITYPE##Array%}
+%typemap(jtype) TYPE *CRITICAL, TYPE CRITICAL[], const TYPE *CRITICAL, const TYPE CRITICAL[] "JTYPE[]"
+%typemap(jstype) TYPE *CRITICAL, TYPE CRITICAL[], const TYPE *CRITICAL, const TYPE CRITICAL[] "JTYPE[]"
+%typemap(javain) TYPE *CRITICAL, TYPE CRITICAL[], const TYPE *CRITICAL, const TYPE CRITICAL[] "$javainput"
+
+%typemap(in) TYPE *CRITICAL, TYPE CRITICAL[], const TYPE *CRITICAL, const TYPE CRITICAL[] {
+  if (!$input) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaNullPointerException, "array null");
+    return $null;
+  }
+  $1 = 0;
+}
+
+/* The check typemaps of the arguments whose freearg typemap has the critical attribute come after the others,
+   no JNI calls are allowed until the arrays are released. $cleanup releases any arrays already held. */
+%typemap(check) TYPE *CRITICAL, TYPE CRITICAL[], const TYPE *CRITICAL, const TYPE CRITICAL[] {
+  $1 = ($1_ltype) JCALL2(GetPrimitiveArrayCritical, jenv, $input, 0);
+  if (!$1) {
+    $cleanup
+    return $null;
+  }
+}
+
+%typemap(argout) TYPE *CRITICAL, TYPE CRITICAL[], const TYPE *CRITICAL, const TYPE CRITICAL[] ""
+
+/* Emitted straight after the wrapped function is called as the critical attribute is set */
+%typemap(freearg, critical="1") TYPE *CRITICAL, TYPE CRITICAL[]
+%{ if ($1) { JCALL3(ReleasePrimitiveArrayCritical, jenv, $input, (void *)$1, 0); $1 = 0; } %}
+
+%typemap(freearg, critical="1") const TYPE *CRITICAL, const TYPE CRITICAL[]
+%{ if ($1) { JCALL3(ReleasePrimitiveArrayCritical, jenv, $input, (void *)$1, JNI_ABORT); $1 = 0; } %}
+
+%typemap(typecheck) TYPE *CRITICAL = TYPECHECKTYPE;
+%typemap(typecheck) TYPE CRITICAL[] = TYPECHECKTYPE;
+%typemap(typecheck) const TYPE *CRITICAL = TYPECHECKTYPE;
+%typemap(typecheck) const TYPE CRITICAL[] = TYPECHECKTYPE;
+%enddef
+
+CRITICAL_TYPEMAP(signed char, jbyte, byte, jbyteArray);
+CRITICAL_TYPEMAP(short, jshort, short, jshortArray);
+CRITICAL_TYPEMAP(int, jint, int, jintArray);
+CRITICAL_TYPEMAP(long long, jlong, long, jlongArray);
+CRITICAL_TYPEMAP(float, jfloat, float, jfloatArray);
+CRITICAL_TYPEMAP(double, jdouble, double, jdoubleArray);
+
+#undef CRITICAL_TYPEMAP
@@ -67,7 +67,7 @@
     int i;
     jsize len=0;
     jstring temp_string;
-    const jclass clazz = JCALL1(FindClass, jenv, "java/lang/String");
+    const jclass clazz = $javaclassref("java/lang/String");
 
     while ($1[len]) len++;
     $result = JCALL3(NewObjectArray, jenv, len, clazz, NULL);
@@ -192,3 +192,44 @@
 }  
 %typemap(freearg) unsigned char *NIOBUFFER ""  
 
+
+/*
+ * TYPE *NIOBUFFER typemaps for the other primitive types.
+ * These map direct java.nio buffers of the primitive type to C arrays without any copy,
+ * so that C and Java share the memory. The pointer passed is the start of the buffer, regardless
+ * of its position. The buffer must be allocated direct and, when created as a view of a
+ * ByteBuffer, in the native byte order.
+ *
+ * Example usage wrapping:
+ *   %apply double *NIOBUFFER { double *samples };
+ *   void scale(double *samples, int n, double factor);
+ *
+ * Java usage:
+ *   java.nio.DoubleBuffer b = java.nio.ByteBuffer.allocateDirect(8 * 1000)
+ *     .order(java.nio.ByteOrder.nativeOrder()).asDoubleBuffer();
+ *   modulename.scale(b, 1000, 2.0);
+ */
+%define NIOBUFFER_TYPEMAP(TYPE, BUFFERTYPE)
+%typemap(jni) TYPE *NIOBUFFER, const TYPE *NIOBUFFER "jobject"
+%typemap(jtype) TYPE *NIOBUFFER, const TYPE *NIOBUFFER "java.nio.BUFFERTYPE"
+%typemap(jstype) TYPE *NIOBUFFER, const TYPE *NIOBUFFER "java.nio.BUFFERTYPE"
+%typemap(javain,
+  pre="  assert $javainput.isDirect() : \"Buffer must be allocated direct.\";") TYPE *NIOBUFFER, const TYPE *NIOBUFFER "$javainput"
+%typemap(in) TYPE *NIOBUFFER, const TYPE *NIOBUFFER {
+  $1 = ($1_ltype) JCALL1(GetDirectBufferAddress, jenv, $input);
+  if ($1 == NULL) {
+    SWIG_JavaThrowException(jenv, SWIG_JavaRuntimeException, "Unable to get address of a java.nio.BUFFERTYPE direct buffer. Buffer must be a direct buffer and not a non-direct buffer.");
+    return $null;
+  }
+}
+%typemap(freearg) TYPE *NIOBUFFER, const TYPE *NIOBUFFER ""
+%enddef
+
+NIOBUFFER_TYPEMAP(signed char, ByteBuffer)
+NIOBUFFER_TYPEMAP(short, ShortBuffer)
+NIOBUFFER_TYPEMAP(int, IntBuffer)
+NIOBUFFER_TYPEMAP(long long, LongBuffer)
+NIOBUFFER_TYPEMAP(float, FloatBuffer)
+NIOBUFFER_TYPEMAP(double, DoubleBuffer)
+
+#undef NIOBUFFER_TYPEMAP
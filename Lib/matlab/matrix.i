@@ -0,0 +1,328 @@
+/* -----------------------------------------------------------------------------
+ * matrix.i
+ *
+ * Dense 2-D numeric mxArrays for matrix data in C++, instead of nested cell
+ * arrays with one mxArray per element:
+ *
+ *   - rectangular std::vector<std::vector<T> > of arithmetic T, one inner
+ *     vector per row, e.g.
+ *
+ *       %include <matrix.i>
+ *       %template(DoubleVector) std::vector<double>;
+ *       %template(DoubleMatrix) std::vector<std::vector<double> >;
+ *
+ *     Ragged vectors are still returned as cell arrays and cell arrays are
+ *     still accepted as input.
+ *
+ *   - (pointer, rows, cols, stride) views of row-major or column-major data,
+ *     to be used with %apply, e.g.
+ *
+ *       %apply (const double *IN_COLMAJOR, int ROWS, int COLS, int STRIDE)
+ *         { (const double *a, int m, int n, int lda) };
+ *       %apply (const double **ARGOUT_ROWMAJOR, int *ROWS, int *COLS, int *STRIDE)
+ *         { (const double **data, int *rows, int *cols, int *stride) };
+ *
+ *     Column-major input of the element class is passed to C++ without a
+ *     copy. Views are available for the arithmetic types below with int and
+ *     size_t dimensions, %matlab_matrix_typemaps(TYPE, DIM_TYPE) adds others.
+ *
+ * Layout changes between row-major C++ data and column-major mxArrays are
+ * done in blocks of SWIG_MATLAB_MATRIX_BLOCK x SWIG_MATLAB_MATRIX_BLOCK
+ * elements so that both sides stay in cache.
+ * ----------------------------------------------------------------------------- */
+
+%include <std_vector.i>
+
+%fragment("MatlabMatrix","header",fragment="<stddef.h>",fragment="StdVectorTraits") {
+%#include <algorithm>
+%#include <cmath>
+%#include <limits>
+
+%#ifndef SWIG_MATLAB_MATRIX_BLOCK
+%#define SWIG_MATLAB_MATRIX_BLOCK 64
+%#endif
+
+namespace swig {
+  /* MATLAB class of integers of a given size and signedness */
+  template <size_t N, bool is_signed> struct matlab_int_class {};
+  template <> struct matlab_int_class<1, true> { static mxClassID id() { return mxINT8_CLASS; } };
+  template <> struct matlab_int_class<1, false> { static mxClassID id() { return mxUINT8_CLASS; } };
+  template <> struct matlab_int_class<2, true> { static mxClassID id() { return mxINT16_CLASS; } };
+  template <> struct matlab_int_class<2, false> { static mxClassID id() { return mxUINT16_CLASS; } };
+  template <> struct matlab_int_class<4, true> { static mxClassID id() { return mxINT32_CLASS; } };
+  template <> struct matlab_int_class<4, false> { static mxClassID id() { return mxUINT32_CLASS; } };
+  template <> struct matlab_int_class<8, true> { static mxClassID id() { return mxINT64_CLASS; } };
+  template <> struct matlab_int_class<8, false> { static mxClassID id() { return mxUINT64_CLASS; } };
+
+  /* MATLAB class with the same element representation as T */
+  template <class T> struct matlab_matrix_class {
+    static mxClassID id() { return matlab_int_class<sizeof(T), std::numeric_limits<T>::is_signed>::id(); }
+  };
+  template <> struct matlab_matrix_class<double> { static mxClassID id() { return mxDOUBLE_CLASS; } };
+  template <> struct matlab_matrix_class<float> { static mxClassID id() { return mxSINGLE_CLASS; } };
+
+  /* Copy a rows x cols matrix with element (i,j) at src[i*srs + j*scs] to
+     dst[i*drs + j*dcs], converting the element type */
+  template <class S, class D>
+  inline void matlab_matrix_copy(const S *src, ptrdiff_t srs, ptrdiff_t scs,
+                                 D *dst, ptrdiff_t drs, ptrdiff_t dcs,
+                                 size_t rows, size_t cols) {
+    if (srs == 1 && drs == 1) {
+      /* Columns are contiguous on both sides */
+      for (size_t j = 0; j < cols; ++j)
+        std::copy(src + j*scs, src + j*scs + rows, dst + j*dcs);
+    } else if (scs == 1 && dcs == 1) {
+      /* Rows are contiguous on both sides */
+      for (size_t i = 0; i < rows; ++i)
+        std::copy(src + i*srs, src + i*srs + cols, dst + i*drs);
+    } else {
+      /* Change of layout */
+      const size_t b = SWIG_MATLAB_MATRIX_BLOCK;
+      for (size_t i0 = 0; i0 < rows; i0 += b) {
+        size_t i1 = std::min(rows, i0 + b);
+        for (size_t j0 = 0; j0 < cols; j0 += b) {
+          size_t j1 = std::min(cols, j0 + b);
+          for (size_t i = i0; i < i1; ++i)
+            for (size_t j = j0; j < j1; ++j)
+              dst[i*drs + j*dcs] = static_cast<D>(src[i*srs + j*scs]);
+        }
+      }
+    }
+  }
+
+  /* Whether pm is a dense, real 2-D matrix that converts to elements of
+     type T: of the class of T, or double with values representable in T.
+     The upper bound 2^digits is exclusive, as (double) of the maximum of a
+     64-bit type rounds up to it. */
+  template <class T>
+  inline bool matlab_matrix_check(const mxArray *pm) {
+    if (!pm || mxIsSparse(pm) || mxIsComplex(pm) || mxGetNumberOfDimensions(pm) != 2) return false;
+    mxClassID id = mxGetClassID(pm);
+    if (id == matlab_matrix_class<T>::id()) return true;
+    if (id != mxDOUBLE_CLASS) return false;
+    if (std::numeric_limits<T>::is_integer) {
+      const double *p = mxGetPr(pm);
+      size_t n = mxGetNumberOfElements(pm);
+      for (size_t k = 0; k < n; ++k) {
+        if (!(p[k] >= (double)std::numeric_limits<T>::min() && p[k] < std::ldexp(1.0, std::numeric_limits<T>::digits))
+            || p[k] != (double)(T)p[k]) return false;
+      }
+    }
+    return true;
+  }
+
+  /* Copy a matrix accepted by matlab_matrix_check to dst, element (i,j) at
+     dst[i*drs + j*dcs] */
+  template <class T>
+  inline void matlab_matrix_read(const mxArray *pm, T *dst, ptrdiff_t drs, ptrdiff_t dcs) {
+    size_t rows = mxGetM(pm), cols = mxGetN(pm);
+    if (mxGetClassID(pm) == mxDOUBLE_CLASS) {
+      matlab_matrix_copy((const double *)mxGetData(pm), 1, rows, dst, drs, dcs, rows, cols);
+    } else {
+      matlab_matrix_copy((const T *)mxGetData(pm), 1, rows, dst, drs, dcs, rows, cols);
+    }
+  }
+
+  /* New rows x cols mxArray of the class of T, element (i,j) from src[i*srs + j*scs] */
+  template <class T>
+  inline mxArray *matlab_matrix_new(const T *src, ptrdiff_t srs, ptrdiff_t scs, size_t rows, size_t cols) {
+    mxArray *pm = mxCreateNumericMatrix(rows, cols, matlab_matrix_class<T>::id(), mxREAL);
+    if (pm && src) matlab_matrix_copy(src, srs, scs, (T *)mxGetData(pm), 1, rows, rows, cols);
+    return pm;
+  }
+
+  /* Element types converted by traits_stdmatrix, see %matlab_matrix_vector */
+  template <class T> struct matlab_matrix_enabled { enum { value = 0 }; };
+
+  /* std::vector<std::vector<T> > as nested cell arrays, unless enabled below */
+  template <class T, bool dense = matlab_matrix_enabled<T>::value>
+  struct traits_stdmatrix {
+    typedef std::vector<std::vector<T> > sequence;
+
+    static int asptr(mxArray *obj, sequence **seq) {
+      return traits_asptr_stdseq<sequence>::asptr(obj, seq);
+    }
+
+    static mxArray *from(const sequence &seq) {
+      return traits_from_stdseq<sequence>::from(seq);
+    }
+  };
+
+  /* std::vector<std::vector<T> > as dense matrices, one inner vector per row */
+  template <class T>
+  struct traits_stdmatrix<T, true> {
+    typedef std::vector<std::vector<T> > sequence;
+
+    /* Transpose column-major src into the rows of seq, block by block */
+    template <class S>
+    static void to_rows(const S *src, size_t rows, size_t cols, sequence &seq) {
+      const size_t b = SWIG_MATLAB_MATRIX_BLOCK;
+      for (size_t i0 = 0; i0 < rows; i0 += b) {
+        size_t i1 = std::min(rows, i0 + b);
+        for (size_t j0 = 0; j0 < cols; j0 += b) {
+          size_t j1 = std::min(cols, j0 + b);
+          for (size_t i = i0; i < i1; ++i) {
+            T *row = &seq[i][0];
+            for (size_t j = j0; j < j1; ++j)
+              row[j] = static_cast<T>(src[i + j*rows]);
+          }
+        }
+      }
+    }
+
+    static int asptr(mxArray *obj, sequence **seq) {
+      if (!matlab_matrix_check<T>(obj)) {
+        return traits_asptr_stdseq<sequence>::asptr(obj, seq);
+      }
+      if (seq) {
+        size_t rows = mxGetM(obj), cols = mxGetN(obj);
+        *seq = new sequence(rows, std::vector<T>(cols));
+        if (mxGetClassID(obj) == mxDOUBLE_CLASS) {
+          to_rows((const double *)mxGetData(obj), rows, cols, **seq);
+        } else {
+          to_rows((const T *)mxGetData(obj), rows, cols, **seq);
+        }
+      }
+      return SWIG_NEWOBJ;
+    }
+
+    static mxArray *from(const sequence &seq) {
+      size_t rows = seq.size();
+      size_t cols = rows ? seq[0].size() : 0;
+      for (size_t i = 1; i < rows; ++i) {
+        if (seq[i].size() != cols) return traits_from_stdseq<sequence>::from(seq);
+      }
+      mxArray *pm = matlab_matrix_new<T>(0, 0, 0, rows, cols);
+      if (!pm || !rows || !cols) return pm;
+      T *dst = (T *)mxGetData(pm);
+      const size_t b = SWIG_MATLAB_MATRIX_BLOCK;
+      for (size_t i0 = 0; i0 < rows; i0 += b) {
+        size_t i1 = std::min(rows, i0 + b);
+        for (size_t j0 = 0; j0 < cols; j0 += b) {
+          size_t j1 = std::min(cols, j0 + b);
+          for (size_t i = i0; i < i1; ++i) {
+            const T *row = &seq[i][0];
+            for (size_t j = j0; j < j1; ++j)
+              dst[i + j*rows] = row[j];
+          }
+        }
+      }
+      return pm;
+    }
+  };
+
+  template <class T>
+  struct traits_asptr<std::vector<std::vector<T> > > {
+    static int asptr(mxArray *obj, std::vector<std::vector<T> > **vec) {
+      return traits_stdmatrix<T>::asptr(obj, vec);
+    }
+  };
+
+  template <class T>
+  struct traits_from<std::vector<std::vector<T> > > {
+    static mxArray *from(const std::vector<std::vector<T> > &vec) {
+      return traits_stdmatrix<T>::from(vec);
+    }
+  };
+}
+}
+
+/* Dense conversion of std::vector<std::vector<TYPE> > */
+%define %matlab_matrix_vector(TYPE...)
+%fragment(%fragment_name(MatlabMatrix, TYPE),"header",fragment="MatlabMatrix") {
+namespace swig {
+  template <> struct matlab_matrix_enabled<TYPE > { enum { value = 1 }; };
+}
+}
+%fragment(%fragment_name(MatlabMatrix, TYPE));
+%enddef
+
+/* (pointer, rows, cols, stride) views of TYPE elements with DIM_TYPE dimensions */
+%define %matlab_matrix_typemaps(TYPE, DIM_TYPE)
+
+/* Input, column-major, STRIDE is the distance between columns */
+%typemap(in,fragment="MatlabMatrix") (const TYPE *IN_COLMAJOR, DIM_TYPE ROWS, DIM_TYPE COLS, DIM_TYPE STRIDE) (bool is_new = false) {
+  if (!swig::matlab_matrix_check<TYPE >($input)) {
+    %argument_fail(SWIG_TypeError, "$type", $symname, $argnum);
+  }
+  $2 = (DIM_TYPE) mxGetM($input);
+  $3 = (DIM_TYPE) mxGetN($input);
+  $4 = $2;
+  if (mxGetClassID($input) == swig::matlab_matrix_class<TYPE >::id()) {
+    $1 = (TYPE *) mxGetData($input);
+  } else {
+    TYPE *tmp = new TYPE[mxGetNumberOfElements($input)];
+    swig::matlab_matrix_read($input, tmp, 1, (ptrdiff_t) $2);
+    $1 = tmp;
+    is_new = true;
+  }
+}
+%typemap(freearg) (const TYPE *IN_COLMAJOR, DIM_TYPE ROWS, DIM_TYPE COLS, DIM_TYPE STRIDE) {
+  if (is_new$argnum) delete[] $1;
+}
+%typemap(typecheck,precedence=SWIG_TYPECHECK_POINTER,fragment="MatlabMatrix") (const TYPE *IN_COLMAJOR, DIM_TYPE ROWS, DIM_TYPE COLS, DIM_TYPE STRIDE) {
+  $1 = swig::matlab_matrix_check<TYPE >($input);
+}
+
+/* Input, row-major, STRIDE is the distance between rows */
+%typemap(in,fragment="MatlabMatrix") (const TYPE *IN_ROWMAJOR, DIM_TYPE ROWS, DIM_TYPE COLS, DIM_TYPE STRIDE) {
+  if (!swig::matlab_matrix_check<TYPE >($input)) {
+    %argument_fail(SWIG_TypeError, "$type", $symname, $argnum);
+  }
+  $2 = (DIM_TYPE) mxGetM($input);
+  $3 = (DIM_TYPE) mxGetN($input);
+  $4 = $3;
+  TYPE *tmp = new TYPE[mxGetNumberOfElements($input)];
+  swig::matlab_matrix_read($input, tmp, (ptrdiff_t) $3, 1);
+  $1 = tmp;
+}
+%typemap(freearg) (const TYPE *IN_ROWMAJOR, DIM_TYPE ROWS, DIM_TYPE COLS, DIM_TYPE STRIDE) {
+  delete[] $1;
+}
+%typemap(typecheck,precedence=SWIG_TYPECHECK_POINTER,fragment="MatlabMatrix") (const TYPE *IN_ROWMAJOR, DIM_TYPE ROWS, DIM_TYPE COLS, DIM_TYPE STRIDE) {
+  $1 = swig::matlab_matrix_check<TYPE >($input);
+}
+
+/* Output, the function sets a view of its data which is copied to a new mxArray */
+%typemap(in,numinputs=0) (const TYPE **ARGOUT_COLMAJOR, DIM_TYPE *ROWS, DIM_TYPE *COLS, DIM_TYPE *STRIDE)
+  (const TYPE *data = 0, DIM_TYPE rows = 0, DIM_TYPE cols = 0, DIM_TYPE stride = 0) {
+  $1 = ($1_ltype) &data;
+  $2 = &rows;
+  $3 = &cols;
+  $4 = &stride;
+}
+%typemap(argout,fragment="MatlabMatrix") (const TYPE **ARGOUT_COLMAJOR, DIM_TYPE *ROWS, DIM_TYPE *COLS, DIM_TYPE *STRIDE) {
+  $result = SWIG_AppendOutput($result, swig::matlab_matrix_new<TYPE >(*$1, 1, (ptrdiff_t) *$4, (size_t) *$2, (size_t) *$3));
+}
+
+%typemap(in,numinputs=0) (const TYPE **ARGOUT_ROWMAJOR, DIM_TYPE *ROWS, DIM_TYPE *COLS, DIM_TYPE *STRIDE)
+  (const TYPE *data = 0, DIM_TYPE rows = 0, DIM_TYPE cols = 0, DIM_TYPE stride = 0) {
+  $1 = ($1_ltype) &data;
+  $2 = &rows;
+  $3 = &cols;
+  $4 = &stride;
+}
+%typemap(argout,fragment="MatlabMatrix") (const TYPE **ARGOUT_ROWMAJOR, DIM_TYPE *ROWS, DIM_TYPE *COLS, DIM_TYPE *STRIDE) {
+  $result = SWIG_AppendOutput($result, swig::matlab_matrix_new<TYPE >(*$1, (ptrdiff_t) *$4, 1, (size_t) *$2, (size_t) *$3));
+}
+
+%enddef
+
+%define %matlab_matrix(TYPE...)
+%matlab_matrix_vector(TYPE)
+%matlab_matrix_typemaps(TYPE, int)
+%matlab_matrix_typemaps(TYPE, size_t)
+%enddef
+
+%matlab_matrix(double);
+%matlab_matrix(float);
+%matlab_matrix(signed char);
+%matlab_matrix(unsigned char);
+%matlab_matrix(short);
+%matlab_matrix(unsigned short);
+%matlab_matrix(int);
+%matlab_matrix(unsigned int);
+%matlab_matrix(long);
+%matlab_matrix(unsigned long);
+%matlab_matrix(long long);
+%matlab_matrix(unsigned long long);
@@ -105,3 +105,224 @@
 
 
 
+
+/* -----------------------------------------------------------------------------
+ * Exporting wrapped objects with the buffer protocol
+ *
+ * %pybuffer_export(CLASS, TYPE, NDIM, DATA, SHAPE, STRIDES)
+ * %pybuffer_export_readonly(CLASS, TYPE, NDIM, DATA, SHAPE, STRIDES)
+ *
+ * Macros for classes holding an NDIM dimensional array of TYPE, so that
+ * memoryview, numpy and the like can use the memory without copying it.
+ * DATA is the address of the first element, SHAPE and STRIDES are lists of
+ * NDIM sizes and strides (in bytes) in parentheses, all of them using self_
+ * for the object. For example:
+ *
+ *      %pybuffer_export(Matrix, double, 2, self_->data(),
+ *                       (self_->rows(), self_->cols()),
+ *                       (self_->cols() * sizeof(double), sizeof(double)));
+ *
+ * The wrapped class gets a __buffer__(flags) method returning a memoryview,
+ * which Python 3.12 and later use for memoryview(obj). Built-in types
+ * (-builtin) implement bf_getbuffer as well. The view keeps the Python object
+ * alive, but can't stop C++ code from reallocating the memory, for example by
+ * resizing a std::vector while it is viewed. The element format comes from
+ * swig::pybuffer_format<TYPE>, which can be specialized for other types, and
+ * NDIM can be at most SWIG_PYBUFFER_MAXDIM (8).
+ *
+ * %pybuffer_export_vector(TYPE) and %pybuffer_export_array(TYPE, N) export
+ * std::vector<TYPE> and std::array<TYPE, N> for arithmetic TYPE (but not
+ * bool for std::vector), use them before the %template.
+ * ----------------------------------------------------------------------------- */
+
+%fragment("SwigPyBufferExport","header") %{
+#if PY_VERSION_HEX < 0x03020000
+# error "%pybuffer_export requires Python 3.2 or later"
+#endif
+
+#define SWIG_PYBUFFER_MAXDIM 8
+
+/* Exporter behind the memoryview returned by __buffer__, it owns a reference
+   to the wrapped object and describes its memory */
+typedef struct {
+  PyObject_HEAD
+  PyObject *owner;
+  void *buf;
+  const char *format;
+  Py_ssize_t itemsize;
+  int ndim;
+  int readonly;
+  Py_ssize_t shape[SWIG_PYBUFFER_MAXDIM];
+  Py_ssize_t strides[SWIG_PYBUFFER_MAXDIM];
+} SwigPyBuffer;
+
+SWIGINTERN int
+SwigPyBuffer_getbuffer(PyObject *obj, Py_buffer *view, int flags) {
+  SwigPyBuffer *b = (SwigPyBuffer *)obj;
+  Py_ssize_t len = b->itemsize;
+  int i;
+  if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && b->readonly) {
+    PyErr_SetString(PyExc_BufferError, "buffer is read-only");
+    view->obj = 0;
+    return -1;
+  }
+  for (i = 0; i < b->ndim; ++i)
+    len *= b->shape[i];
+  view->obj = obj;
+  view->buf = b->buf ? b->buf : (void *)b->shape;
+  view->len = len;
+  view->readonly = b->readonly;
+  view->itemsize = b->itemsize;
+  view->format = (flags & PyBUF_FORMAT) == PyBUF_FORMAT ? (char *)b->format : 0;
+  view->ndim = b->ndim;
+  view->shape = (flags & PyBUF_ND) == PyBUF_ND ? b->shape : 0;
+  view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? b->strides : 0;
+  view->suboffsets = 0;
+  view->internal = 0;
+  if (((flags & PyBUF_STRIDES) != PyBUF_STRIDES || (flags & PyBUF_C_CONTIGUOUS) == PyBUF_C_CONTIGUOUS) && !PyBuffer_IsContiguous(view, 'C')) {
+    PyErr_SetString(PyExc_BufferError, "buffer is not C-contiguous");
+    view->obj = 0;
+    return -1;
+  }
+  if (((flags & PyBUF_F_CONTIGUOUS) == PyBUF_F_CONTIGUOUS && !PyBuffer_IsContiguous(view, 'F')) ||
+      ((flags & PyBUF_ANY_CONTIGUOUS) == PyBUF_ANY_CONTIGUOUS && !PyBuffer_IsContiguous(view, 'A'))) {
+    PyErr_SetString(PyExc_BufferError, "buffer is not contiguous");
+    view->obj = 0;
+    return -1;
+  }
+  Py_INCREF(obj);
+  return 0;
+}
+
+SWIGINTERN void
+SwigPyBuffer_dealloc(PyObject *obj) {
+  PyTypeObject *tp = Py_TYPE(obj);
+  Py_XDECREF(((SwigPyBuffer *)obj)->owner);
+  PyObject_Del(obj);
+#if PY_VERSION_HEX >= 0x03080000
+  Py_DECREF(tp);
+#else
+  (void)tp;
+#endif
+}
+
+SWIGINTERN PyTypeObject *
+SwigPyBuffer_TypeOnce(void) {
+  static PyType_Slot slots[] = {
+    { Py_bf_getbuffer, (void *)SwigPyBuffer_getbuffer },
+    { Py_tp_dealloc, (void *)SwigPyBuffer_dealloc },
+    { 0, 0 }
+  };
+  static PyType_Spec spec = {
+    "swig.SwigPyBuffer", sizeof(SwigPyBuffer), 0, Py_TPFLAGS_DEFAULT, slots
+  };
+  static PyObject *type = 0;
+  if (!type)
+    type = PyType_FromSpec(&spec);
+  return (PyTypeObject *)type;
+}
+
+/* Describes the memory of a wrapped object, filled in by %pybuffer_export */
+SWIGINTERN SwigPyBuffer *
+SwigPyBuffer_New(PyObject *owner, const char *format, Py_ssize_t itemsize, int ndim, int readonly) {
+  PyTypeObject *tp;
+  SwigPyBuffer *b;
+  if (!format) {
+    PyErr_SetString(PyExc_BufferError, "no buffer format for the element type, see swig::pybuffer_format");
+    return 0;
+  }
+  tp = SwigPyBuffer_TypeOnce();
+  b = tp ? PyObject_New(SwigPyBuffer, tp) : 0;
+  if (b) {
+    Py_INCREF(owner);
+    b->owner = owner;
+    b->buf = 0;
+    b->format = format;
+    b->itemsize = itemsize;
+    b->ndim = ndim;
+    b->readonly = readonly;
+  }
+  return b;
+}
+
+/* Returns a memoryview of the exporter and releases it */
+SWIGINTERN PyObject *
+SwigPyBuffer_MemoryView(SwigPyBuffer *b, int flags) {
+  PyObject *view;
+  if (!b)
+    return 0;
+  if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && b->readonly) {
+    PyErr_SetString(PyExc_BufferError, "buffer is read-only");
+    Py_DECREF(b);
+    return 0;
+  }
+  view = PyMemoryView_FromObject((PyObject *)b);
+  Py_DECREF(b);
+  return view;
+}
+
+/* bf_getbuffer of built-in types, gets the buffer from the __buffer__ method */
+SWIGINTERN int
+SwigPyBuffer_GetBufferMethod(PyObject *obj, Py_buffer *view, int flags) {
+  int res;
+  PyObject *mv = PyObject_CallMethod(obj, (char *)"__buffer__", (char *)"i", flags);
+  if (!mv) {
+    view->obj = 0;
+    return -1;
+  }
+  res = PyObject_GetBuffer(mv, view, flags);
+  Py_DECREF(mv);
+  return res;
+}
+%}
+
+%fragment("SwigPyBufferTraits","header",fragment="SwigPyBufferFormat") %{
+namespace swig {
+  /* A size or stride of any integer type */
+  struct pybuffer_dim {
+    template <class Type> pybuffer_dim(Type v) : value((Py_ssize_t)v) {}
+    Py_ssize_t value;
+  };
+}
+%}
+
+%define %_pybuffer_export(CLASS, TYPE, NDIM, DATA, SHAPE, STRIDES, READONLY)
+%fragment("SwigPyBufferExport");
+%fragment("SwigPyBufferTraits");
+#if defined(SWIGPYTHON_BUILTIN)
+%feature("python:bf_getbuffer") CLASS "SwigPyBuffer_GetBufferMethod";
+#endif
+%extend CLASS {
+  PyObject *__buffer__(PyObject **PYTHON_SELF, int flags) {
+    const CLASS *self_ = $self;
+    const swig::pybuffer_dim shape_[] = { %arg SHAPE };
+    const swig::pybuffer_dim strides_[] = { %arg STRIDES };
+    SwigPyBuffer *b = SwigPyBuffer_New(*PYTHON_SELF, swig::pybuffer_format< TYPE >::value(), sizeof(TYPE), NDIM, READONLY);
+    int i;
+    if (b) {
+      b->buf = (void *)(DATA);
+      for (i = 0; i < NDIM; ++i) {
+        b->shape[i] = shape_[i].value;
+        b->strides[i] = strides_[i].value;
+      }
+    }
+    return SwigPyBuffer_MemoryView(b, flags);
+  }
+}
+%enddef
+
+%define %pybuffer_export(CLASS, TYPE, NDIM, DATA, SHAPE, STRIDES)
+%_pybuffer_export(%arg(CLASS), %arg(TYPE), NDIM, %arg(DATA), SHAPE, STRIDES, 0)
+%enddef
+
+%define %pybuffer_export_readonly(CLASS, TYPE, NDIM, DATA, SHAPE, STRIDES)
+%_pybuffer_export(%arg(CLASS), %arg(TYPE), NDIM, %arg(DATA), SHAPE, STRIDES, 1)
+%enddef
+
+%define %pybuffer_export_vector(TYPE...)
+%pybuffer_export(std::vector< TYPE >, TYPE, 1, self_->empty() ? 0 : &(*self_)[0], (self_->size()), (sizeof(TYPE)))
+%enddef
+
+%define %pybuffer_export_array(TYPE, N)
+%pybuffer_export(%arg(std::array< TYPE, N >), TYPE, 1, self_->data(), (N), (sizeof(TYPE)))
+%enddef
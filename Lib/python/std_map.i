@@ -125,8 +125,12 @@
 	  SWIG_PYTHON_THREAD_END_BLOCK;
 	  return NULL;
 	}
+%#if PY_VERSION_HEX >= 0x02060000 && PY_VERSION_HEX < 0x030D0000 && !defined(Py_LIMITED_API)
+	PyObject *obj = _PyDict_NewPresized(pysize);
+%#else
 	PyObject *obj = PyDict_New();
-	for (const_iterator i= map.begin(); i!= map.end(); ++i) {
+%#endif
+	for (const_iterator i= map.begin(); obj && i!= map.end(); ++i) {
 	  swig::SwigVar_PyObject key = swig::from(i->first);
 	  swig::SwigVar_PyObject val = swig::from(i->second);
 	  PyDict_SetItem(obj, key, val);
@@ -300,6 +304,10 @@
     PyObject* asdict() {
       return swig::traits_from< Map >::asdict(*self);
     }
+
+    PyObject* todict() {
+      return swig::traits_from< Map >::asdict(*self);
+    }
   }
 
 
@@ -35,6 +35,7 @@
 %define %swig_set_methods(set...)
   %swig_sequence_iterator(set);
   %swig_container_methods(set);
+  %fragment("SwigPySequence_ToList");
 
   %extend  {
      void append(value_type x) {
@@ -57,6 +58,10 @@
        self->erase(x);
      }
 
+     PyObject *tolist() const {
+       return swig::container_aslist(*self);
+     }
+
   };
 %enddef
 
@@ -35,6 +35,7 @@
 %define %swig_unordered_set_methods(unordered_set...)
   %swig_sequence_iterator(unordered_set);
   %swig_container_methods(unordered_set);
+  %fragment("SwigPySequence_ToList");
 
   %extend  {
      void append(value_type x) {
@@ -49,6 +50,9 @@
        return *(swig::cgetpos(self, i));
      }
 
+     PyObject *tolist() const {
+       return swig::container_aslist(*self);
+     }
   };
 %enddef
 
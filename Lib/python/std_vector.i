@@ -2,9 +2,55 @@
   Vectors
 */
 
-%fragment("StdVectorTraits","header",fragment="StdSequenceTraits")
+%fragment("StdVectorTraits","header",fragment="StdSequenceTraits",fragment="SwigPyBufferFormat")
 %{
   namespace swig {
+    template <class T>
+    struct traits_stdseq_storage<std::vector<T> > {
+      static void reserve(std::vector<T> *vec, size_t n) {
+	vec->reserve(n);
+      }
+
+      // Buffers of T (array.array, numpy arrays, ...) are copied as a whole
+      static int asbuffer(PyObject *obj, std::vector<T> **vec) {
+#if PY_VERSION_HEX >= 0x02060000
+	Py_buffer view;
+	int res = SWIG_ERROR;
+	if (!swig::pybuffer_format<T>::value() || !PyObject_CheckBuffer(obj))
+	  return SWIG_ERROR;
+	if (PyObject_GetBuffer(obj, &view, PyBUF_FORMAT | PyBUF_C_CONTIGUOUS) != 0) {
+	  PyErr_Clear();
+	  return SWIG_ERROR;
+	}
+	if (view.ndim == 1 && swig::pybuffer_format_check<T>(view)) {
+	  if (vec) {
+	    const T *data = static_cast<const T *>(view.buf);
+	    *vec = new std::vector<T>(data, data + view.len / view.itemsize);
+	    res = SWIG_NEWOBJ;
+	  } else {
+	    res = SWIG_OK;
+	  }
+	}
+	PyBuffer_Release(&view);
+	return res;
+#else
+	return SWIG_ERROR;
+#endif
+      }
+    };
+
+    // std::vector<bool> is packed
+    template <>
+    struct traits_stdseq_storage<std::vector<bool> > {
+      static void reserve(std::vector<bool> *vec, size_t n) {
+	vec->reserve(n);
+      }
+
+      static int asbuffer(PyObject *, std::vector<bool> **) {
+	return SWIG_ERROR;
+      }
+    };
+
     template <class T>
     struct traits_asptr<std::vector<T> >  {
       static int asptr(PyObject *obj, std::vector<T> **vec) {
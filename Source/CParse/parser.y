@@ -3804,8 +3804,20 @@ cpp_class_decl  : storage_class cpptype idcolon inherit LBRACE {
 		   add_symbols($$);
 		   add_symbols(n);
 		   Delattr($$, "class_rename");
-		 }else if (cparse_cplusplus)
+		 }else if (cparse_cplusplus) {
+		   if (currentOuterClass) {
+		     /* remember the instances of the ignored unnamed struct as they still take storage in the outer class */
+		     List *instances = Getattr(currentOuterClass, "nested:unnamedinstances");
+		     if (!instances) {
+		       instances = NewList();
+		       Setattr(currentOuterClass, "nested:unnamedinstances", instances);
+		       Delete(instances);
+		     }
+		     for (n = $8; n; n = nextSibling(n))
+		       Append(instances, n);
+		   }
 		   $$ = 0; /* ignore unnamed structs for C++ */
+		 }
 	         Delete(unnamed);
 	       } else { /* unnamed struct w/o declarator*/
 		 Swig_symbol_popscope();
@@ -3813,6 +3825,12 @@ cpp_class_decl  : storage_class cpptype idcolon inherit LBRACE {
 		 Namespaceprefix = Swig_symbol_qualifiedscopename(0);
 		 add_symbols($6);
 		 Delete($$);
+		 if (currentOuterClass) {
+		   /* mark the members as they are laid out together in the outer class, not one after another */
+		   Node *member;
+		   for (member = $6; member; member = nextSibling(member))
+		     Setattr(member, "nested:anonymous", $2);
+		 }
 		 $$ = $6; /* pass member list to outer class/namespace (instead of self)*/
 	       }
 	       Classprefix = currentOuterClass ? Getattr(currentOuterClass, "Classprefix") : 0;
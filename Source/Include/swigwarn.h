@@ -229,6 +229,7 @@
 #define WARN_D_CANTHROW_MISSING               711
 #define WARN_D_NO_DIRECTORCONNECT_ATTR        712
 #define WARN_D_NAME_COLLISION                 713
+#define WARN_D_NOGC_IGNORED                   714
 
 /* please leave 700-719 free for D */
 
@@ -262,6 +263,7 @@
 #define WARN_JAVA_TYPEMAP_DIRECTORIN_NODESC   824
 #define WARN_JAVA_NO_DIRECTORCONNECT_ATTR     825
 #define WARN_JAVA_NSPACE_WITHOUT_PACKAGE      826
+#define WARN_JAVA_CRITICAL_EXCEPTION          827
 
 /* please leave 810-829 free for Java */
 
@@ -306,6 +308,7 @@
 /* please leave 870-889 free for PHP */
 
 #define WARN_GO_NAME_CONFLICT                 890
+#define WARN_GO_BATCH                         891
 
 /* please leave 890-899 free for Go */
 
@@ -91,6 +91,10 @@ class CSHARP:public Language {
   int curr_class_dmethod;
   int nesting_depth;
 
+  // Constants obtained all at once by SWIGConstantsInit, see constantsInitValue()
+  String *constants_init_code;	// C code filling in the values
+  int n_constants_init;		// number of values
+
   enum EnumFeature { SimpleEnum, TypeunsafeEnum, TypesafeEnum, ProperEnum };
 
 public:
@@ -162,7 +166,9 @@ public:
       n_directors(0),
       first_class_dmethod(0),
       curr_class_dmethod(0),
-      nesting_depth(0){
+      nesting_depth(0),
+      constants_init_code(NULL),
+      n_constants_init(0){
     /* for now, multiple inheritance in directors is disabled, this
        should be easy to implement though */
     director_multiple_inheritance = 0;
@@ -394,6 +400,8 @@ public:
     dmethods_table = NewHash();
     n_dmethods = 0;
     n_directors = 0;
+    constants_init_code = NewString("");
+    n_constants_init = 0;
     if (!dllimport)
       dllimport = Copy(module_class_name);
 
@@ -474,6 +482,7 @@ public:
       Replaceall(imclass_class_code, "$dllimport", dllimport);
       Printv(f_im, imclass_class_code, NIL);
       Printv(f_im, imclass_cppcasts_code, NIL);
+      emitConstantsInit(f_im);
 
       // Finish off the class
       Printf(f_im, "}\n");
@@ -603,6 +612,9 @@ public:
     Delete(namespce);
     namespce = NULL;
     n_dmethods = 0;
+    Delete(constants_init_code);
+    constants_init_code = NULL;
+    n_constants_init = 0;
 
     /* Close all of the files */
     Dump(f_runtime, f_begin);
@@ -815,6 +827,7 @@ public:
       if (imtypeout)
 	tm = imtypeout;
       Printf(im_return_type, "%s", tm);
+      substituteClassname(t, im_return_type);
       im_outattributes = Getattr(n, "tmap:imtype:outattributes");
     } else {
       Swig_warning(WARN_CSHARP_TYPEMAP_CSTYPE_UNDEF, input_file, line_number, "No imtype typemap defined for %s\n", SwigType_str(t, 0));
@@ -884,6 +897,7 @@ public:
       if ((tm = Getattr(p, "tmap:imtype"))) {
 	const String *inattributes = Getattr(p, "tmap:imtype:inattributes");
 	Printf(im_param_type, "%s%s", inattributes ? inattributes : empty_string, tm);
+	substituteClassname(pt, im_param_type);
       } else {
 	Swig_warning(WARN_CSHARP_TYPEMAP_CSTYPE_UNDEF, input_file, line_number, "No imtype typemap defined for %s\n", SwigType_str(pt, 0));
       }
@@ -1327,6 +1341,13 @@ public:
       String *val = NewStringf("'%(hexescape)s'", Getattr(n, "enumvalue"));
       Setattr(n, "enumvalue", val);
       Delete(val);
+    } else {
+      // The value evaluated by SWIG is used instead of the C syntax by proper enums and %csconst(1), see enumValue()
+      String *foldedvalue = fold_enum_value(n);
+      if (foldedvalue) {
+	Setattr(n, "foldedvalue", foldedvalue);
+	Delete(foldedvalue);
+      }
     }
 
     {
@@ -1376,7 +1397,8 @@ public:
 	String *value = Getattr(n, "feature:cs:constvalue");
 
 	// Note that the enum value must be a true constant and cannot be set from a PINVOKE call, thus no support for %csconst(0)
-	value = value ? value : Getattr(n, "enumvalue");
+	if (!value && Getattr(n, "enumvalue"))
+	  value = Getattr(n, "foldedvalue") ? Getattr(n, "foldedvalue") : Getattr(n, "enumvalue");
 	if (value) {
 	  Printf(enum_code, " = %s", value);
 	}
@@ -1477,6 +1499,9 @@ public:
 
     // The %csconst feature determines how the constant value is obtained
     int const_feature_flag = GetFlag(n, "feature:cs:const");
+    // A value which overflows is obtained from C/C++ as its C expression would not give the same C# value
+    if (const_feature_flag && !is_enum_item && fold_constant_overflow(n))
+      const_feature_flag = 0;
 
     /* Adjust the enum type for the Swig_typemap_lookup.
      * We want the same jstype typemap for all the enum items so we use the enum type (parent node). */
@@ -1529,8 +1554,19 @@ public:
       Printf(constants_code, "%s;\n", value);
     } else if (!const_feature_flag) {
       // Default enum and constant handling will work with any type of C constant and initialises the C# variable from C through a PINVOKE call.
+      // Constants of the primitive types are all obtained by a single PINVOKE call, see constantsInitValue().
+      bool is_enum = is_enum_item || SwigType_isenum(t);
+      String *initvalue = (!classname_substituted_flag || is_enum) ? constantsInitValue(n, t, is_enum) : 0;
 
-      if (classname_substituted_flag) {
+      if (initvalue) {
+	if (classname_substituted_flag)
+	  Printf(constants_code, "(%s)%s;\n", return_type, initvalue);
+	else
+	  Printf(constants_code, "%s;\n", initvalue);
+	// Used by enumValue()
+	Setattr(n, "constantsinitvalue", initvalue);
+	Delete(initvalue);
+      } else if (classname_substituted_flag) {
 	if (SwigType_isenum(t)) {
 	  // This handles wrapping of inline initialised const enum static member variables (not when wrapping enum items - ignored later on)
 	  Printf(constants_code, "(%s)%s.%s();\n", return_type, full_imclass_name, Swig_name_get(getNSpace(), symname));
@@ -1542,25 +1578,34 @@ public:
 	Printf(constants_code, "%s.%s();\n", full_imclass_name ? full_imclass_name : imclass_name, Swig_name_get(getNSpace(), symname));
       }
 
-      // Each constant and enum value is wrapped with a separate PInvoke function call
-      SetFlag(n, "feature:immutable");
-      enum_constant_flag = true;
-      variableWrapper(n);
-      enum_constant_flag = false;
+      if (!initvalue) {
+	// Each remaining constant and enum value is wrapped with a separate PInvoke function call
+	SetFlag(n, "feature:immutable");
+	enum_constant_flag = true;
+	variableWrapper(n);
+	enum_constant_flag = false;
+      }
     } else {
-      // Alternative constant handling will use the C syntax to make a true C# constant and hope that it compiles as C# code
+      // Alternative constant handling will use the C syntax to make a true C# constant and hope that it compiles as C# code,
+      // unless the value of an integral constant can be evaluated by SWIG
+      String *foldedvalue = 0;
       if (Getattr(n, "wrappedasconstant")) {
 	if (SwigType_type(t) == T_CHAR) {
 	  if (SwigType_type(valuetype) == T_CHAR)
 	    Printf(constants_code, "\'%(hexescape)s\';\n", Getattr(n, "staticmembervariableHandler:value"));
 	  else
 	    Printf(constants_code, "(char)%s;\n", Getattr(n, "staticmembervariableHandler:value"));
+	} else if ((foldedvalue = fold_constant_value(Getattr(n, "staticmembervariableHandler:value"), t, 0))) {
+          Printf(constants_code, "%s;\n", foldedvalue);
 	} else {
           Printf(constants_code, "%s;\n", Getattr(n, "staticmembervariableHandler:value"));
 	}
+      } else if (!is_enum_item && (foldedvalue = fold_constant_value(Getattr(n, "value"), t, 0))) {
+        Printf(constants_code, "%s;\n", foldedvalue);
       } else {
         Printf(constants_code, "%s;\n", Getattr(n, "value"));
       }
+      Delete(foldedvalue);
     }
 
     // Emit the generated code to appropriate place
@@ -1579,6 +1624,111 @@ public:
     return SWIG_OK;
   }
 
+  /* -----------------------------------------------------------------------
+   * constantsInitValue()
+   * Adds a constant of a primitive type, or an enum, to the values obtained
+   * all at once by the SWIGConstantsInit PINVOKE call when the intermediary
+   * class is initialised, instead of using a PINVOKE call per constant.
+   * Returns the C# expression for the value or NULL if the type is not supported.
+   * ------------------------------------------------------------------------ */
+
+  String *constantsInitValue(Node *n, SwigType *t, bool is_enum) {
+    switch (is_enum ? T_INT : SwigType_type(t)) {
+    case T_BOOL:
+    case T_SCHAR:
+    case T_UCHAR:
+    case T_SHORT:
+    case T_USHORT:
+    case T_INT:
+    case T_UINT:
+    case T_LONG:
+    case T_ULONG:
+    case T_LONGLONG:
+    case T_FLOAT:
+    case T_DOUBLE:
+      break;
+    default:
+      return 0;
+    }
+
+    // Only the default typemaps are supported, the values are passed as a long long or as the bits of a double
+    static const char *primitives[][3] = {
+      { "unsigned int", "bool", "%s != 0" },
+      { "signed char", "sbyte", "(sbyte)%s" },
+      { "unsigned char", "byte", "(byte)%s" },
+      { "short", "short", "(short)%s" },
+      { "unsigned short", "ushort", "(ushort)%s" },
+      { "int", "int", "(int)%s" },
+      { "unsigned int", "uint", "(uint)%s" },
+      { "long", "int", "(int)%s" },
+      { "unsigned long", "uint", "(uint)%s" },
+      { "long long", "long", "%s" },
+      { "float", "float", "(float)global::System.BitConverter.Int64BitsToDouble(%s)" },
+      { "double", "double", "global::System.BitConverter.Int64BitsToDouble(%s)" }
+    };
+    String *ctype = Swig_typemap_lookup("ctype", n, "", 0);
+    String *imtype = Swig_typemap_lookup("imtype", n, "", 0);
+    int i;
+    for (i = 0; i < (int)(sizeof(primitives)/sizeof(primitives[0])); i++) {
+      if (Equal(ctype, primitives[i][0]) && Equal(imtype, primitives[i][1]) && !Getattr(n, "tmap:imtype:out") && !Getattr(n, "tmap:imtype:outattributes"))
+	break;
+    }
+    if (i == (int)(sizeof(primitives)/sizeof(primitives[0])))
+      return 0;
+
+    // Same C expression as the constant's getter generated by variableWrapper()
+    String *cvalue = 0;
+    if (Equal(nodeType(n), "constant"))
+      cvalue = NewStringf("(%s)", Getattr(n, "rawval") ? Getattr(n, "rawval") : Getattr(n, "value"));
+    else
+      cvalue = SwigType_namestr(Getattr(n, "name"));
+    SwigType *lt = SwigType_ltype(t);
+    String *cast = SwigType_str(lt, 0);
+    if (Equal(imtype, "float") || Equal(imtype, "double"))
+      Printf(constants_init_code, "{\ndouble d = (double)(%s)%s;\nmemcpy(&values[%d], &d, sizeof(d));\n}\n", cast, cvalue, n_constants_init);
+    else
+      Printf(constants_init_code, "values[%d] = (long long)(%s)%s;\n", n_constants_init, cast, cvalue);
+
+    String *element = NewStringf("%s.SWIGConstants[%d]", full_imclass_name ? full_imclass_name : imclass_name, n_constants_init);
+    String *value = NewStringf(primitives[i][2], element);
+    n_constants_init++;
+    Delete(element);
+    Delete(cast);
+    Delete(lt);
+    Delete(cvalue);
+    return value;
+  }
+
+  /* -----------------------------------------------------------------------
+   * emitConstantsInit()
+   * Emit the SWIGConstantsInit PINVOKE function, which fills in the values of
+   * the constants added by constantsInitValue(), and the intermediary class
+   * array holding these.
+   * ------------------------------------------------------------------------ */
+
+  void emitConstantsInit(File *f_im) {
+    if (n_constants_init) {
+      Wrapper *w = NewWrapper();
+      String *wname = Swig_name_wrapper("SWIGConstantsInit");
+
+      Printf(w->def, "SWIGEXPORT void SWIGSTDCALL %s(long long *values) {", wname);
+      Printv(w->code, constants_init_code, NIL);
+      Printf(w->code, "}\n");
+      Wrapper_print(w, f_wrappers);
+
+      Printv(f_im, "\n  [global::System.Runtime.InteropServices.DllImport(\"", dllimport, "\", EntryPoint=\"", wname, "\")]\n", NIL);
+      Printf(f_im, "  private static extern void SWIGConstantsInit([global::System.Runtime.InteropServices.Out] long[] values);\n\n");
+      Printf(f_im, "  public static readonly long[] SWIGConstants = SWIGConstantsCreate();\n\n");
+      Printf(f_im, "  private static long[] SWIGConstantsCreate() {\n");
+      Printf(f_im, "    long[] values = new long[%d];\n", n_constants_init);
+      Printf(f_im, "    SWIGConstantsInit(values);\n");
+      Printf(f_im, "    return values;\n");
+      Printf(f_im, "  }\n");
+      Delete(wname);
+      DelWrapper(w);
+    }
+  }
+
   /* -----------------------------------------------------------------------------
    * insertDirective()
    * ----------------------------------------------------------------------------- */
@@ -1860,6 +2010,7 @@ public:
 	   ", " : "", interface_list, " {", derived ? typemapLookup(n, "csbody_derived", typemap_lookup_type, WARN_CSHARP_TYPEMAP_CSBODY_UNDEF) :	// main body of class
 	   typemapLookup(n, "csbody", typemap_lookup_type, WARN_CSHARP_TYPEMAP_CSBODY_UNDEF),	// main body of class
 	   NIL);
+    Replaceall(proxy_class_def, "$csbaseclassname", wanted_base);
 
     // C++ destructor is wrapped by the Dispose method
     // Note that the method name is specified in a typemap attribute called methodname
@@ -2004,6 +2155,104 @@ public:
     Delete(baseclass);
   }
 
+  /* ----------------------------------------------------------------------
+   * blittableFieldType()
+   *
+   * C# type of a field of a blittable struct for a data member of the given
+   * type, or NULL if the type has no C# equivalent with the same size.
+   * ---------------------------------------------------------------------- */
+
+  String *blittableFieldType(Node *n, SwigType *type) {
+    String *cstype = NULL;
+    SwigType *resolved = SwigType_typedef_resolve_all(type);
+    SwigType *stripped = SwigType_strip_qualifiers(resolved);
+
+    if (SwigType_ispointer(stripped)) {
+      cstype = NewString("global::System.IntPtr");
+    } else if (SwigType_isenum(stripped)) {
+      cstype = NewString("int");
+    } else if (Cmp(stripped, "long") == 0 || Cmp(stripped, "unsigned long") == 0) {
+      // C# int and uint have the size of long only on some platforms
+    } else if (Node *cls = classLookup(stripped)) {
+      if (GetFlag(cls, "feature:cs:blittable") && !SwigType_isarray(stripped) && !SwigType_isreference(stripped))
+	cstype = Copy(getProxyName(stripped));
+    } else {
+      static const char *blittable_types[] = { "byte", "sbyte", "short", "ushort", "int", "uint", "long", "ulong", "float", "double", 0 };
+      const String *tm = typemapLookup(n, "imtype", stripped, WARN_NONE);
+      for (int i = 0; blittable_types[i]; i++) {
+	if (Strcmp(tm, blittable_types[i]) == 0) {
+	  cstype = Copy(tm);
+	  break;
+	}
+      }
+    }
+    Delete(stripped);
+    Delete(resolved);
+    return cstype;
+  }
+
+  /* ----------------------------------------------------------------------
+   * emitBlittableStruct()
+   *
+   * Emit a C# struct with sequential layout in place of the proxy class for
+   * a class with %feature("cs:blittable"), see blittable.i. It has a field
+   * for each non-static data member, in declaration order, so that it has
+   * the same layout as the C/C++ struct. Member functions are not wrapped.
+   * ---------------------------------------------------------------------- */
+
+  void emitBlittableStruct(Node *n) {
+    String *c_classname = SwigType_namestr(Getattr(n, "name"));
+
+    if (Getattr(n, "bases"))
+      Swig_error(Getfile(n), Getline(n), "Blittable struct %s cannot have base classes.\n", c_classname);
+
+    Printv(proxy_class_def, "[global::System.Runtime.InteropServices.StructLayout(global::System.Runtime.InteropServices.LayoutKind.Sequential)]\n", NIL);
+    const String *csattributes = typemapLookup(n, "csattributes", Getattr(n, "classtypeobj"), WARN_NONE);
+    if (csattributes && *Char(csattributes))
+      Printf(proxy_class_def, "%s\n", csattributes);
+    Printv(proxy_class_def, "public struct $csclassname {\n", NIL);
+
+    for (Node *c = firstChild(n); c; c = nextSibling(c)) {
+      String *storage = Getattr(c, "storage");
+      if (Cmp(nodeType(c), "destructor") == 0 || Cmp(nodeType(c), "constructor") == 0) {
+	if (Cmp(storage, "virtual") == 0)
+	  Swig_error(Getfile(c), Getline(c), "Blittable struct %s cannot have virtual methods.\n", c_classname);
+	continue;
+      }
+      if (Cmp(nodeType(c), "cdecl") != 0 || GetFlag(c, "feature:extend"))
+	continue;
+      if (String *kind = Getattr(c, "nested:anonymous")) {
+	if (!storage && !SwigType_isfunction(Getattr(c, "decl")))
+	  Swig_error(Getfile(c), Getline(c), "Data member %s of blittable struct %s cannot be a member of an anonymous %s.\n", Getattr(c, "name"), c_classname, kind);
+	continue;
+      }
+      SwigType *type = Copy(Getattr(c, "type"));
+      SwigType_push(type, Getattr(c, "decl"));
+      if (SwigType_isfunction(type)) {
+	if (Cmp(storage, "virtual") == 0)
+	  Swig_error(Getfile(c), Getline(c), "Blittable struct %s cannot have virtual methods.\n", c_classname);
+      } else if (!storage) {
+	String *fieldname = Getattr(c, "sym:name") ? Getattr(c, "sym:name") : Getattr(c, "name");
+	String *cstype = Getattr(c, "bitfield") ? NULL : blittableFieldType(c, type);
+	if (cstype) {
+	  Printf(proxy_class_code, "  %s %s %s;\n", is_public(c) ? "public" : "private", cstype, fieldname);
+	  Delete(cstype);
+	} else if (Getattr(c, "bitfield")) {
+	  Swig_error(Getfile(c), Getline(c), "Data member %s of blittable struct %s cannot be a bit field.\n", Getattr(c, "name"), c_classname);
+	} else {
+	  Swig_error(Getfile(c), Getline(c), "Data member %s of blittable struct %s has a type with no blittable C# equivalent: %s.\n",
+		     Getattr(c, "name"), c_classname, SwigType_str(type, 0));
+	}
+      }
+      Delete(type);
+    }
+    // Instances of unnamed nested structs are not in the parse tree for C++, but they take storage
+    for (Iterator it = First(Getattr(n, "nested:unnamedinstances")); it.item; it = Next(it)) {
+      Swig_error(Getfile(it.item), Getline(it.item), "Data member %s of blittable struct %s cannot have an unnamed nested struct or union type.\n", Getattr(it.item, "name"), c_classname);
+    }
+    Delete(c_classname);
+  }
+
   /* ----------------------------------------------------------------------
    * emitInterfaceDeclaration()
    * ---------------------------------------------------------------------- */
@@ -2160,11 +2409,16 @@ public:
       calculateDirectBase(n);
     }
 
-    Language::classHandler(n);
+    bool blittable = proxy_flag && GetFlag(n, "feature:cs:blittable");
+    if (blittable)
+      emitBlittableStruct(n);
+    else
+      Language::classHandler(n);
 
     if (proxy_flag) {
 
-      emitProxyClassDefAndCPPCasts(n);
+      if (!blittable)
+	emitProxyClassDefAndCPPCasts(n);
 
       String *csclazzname = Swig_name_member(getNSpace(), getClassPrefix(), ""); // mangled full proxy class name
 
@@ -3194,6 +3448,8 @@ public:
 	  if ((tm = Getattr(p, "tmap:cstype"))) {
 	    substituteClassname(pt, tm);
             String *cstypeout = Getattr(p, "tmap:cstype:out");	// the type in the cstype typemap's out attribute overrides the type in the typemap
+	    if (cstypeout)
+	      substituteClassname(pt, cstypeout);
 	    variable_type = cstypeout ? cstypeout : tm;
 	  } else {
 	    Swig_warning(WARN_CSHARP_TYPEMAP_CSOUT_UNDEF, input_file, line_number, "No csvarin typemap defined for %s\n", SwigType_str(pt, 0));
@@ -3307,8 +3563,11 @@ public:
       int const_feature_flag = GetFlag(n, "feature:cs:const");
 
       if (const_feature_flag) {
-	// Use the C syntax to make a true C# constant and hope that it compiles as C# code
-	value = Getattr(n, "enumvalue") ? Copy(Getattr(n, "enumvalue")) : Copy(Getattr(n, "enumvalueex"));
+	// Use the value evaluated by SWIG, otherwise the C syntax to make a true C# constant and hope that it compiles as C# code
+	if (Getattr(n, "foldedvalue"))
+	  value = Copy(Getattr(n, "foldedvalue"));
+	else
+	  value = Getattr(n, "enumvalue") ? Copy(Getattr(n, "enumvalue")) : Copy(Getattr(n, "enumvalueex"));
       } else {
 	String *newsymname = 0;
 	if (!getCurrentClass() || !proxy_flag) {
@@ -3330,6 +3589,11 @@ public:
 	  memberconstantHandler(n);
 	  value = NewStringf("%s.%s()", full_imclass_name ? full_imclass_name : imclass_name, Swig_name_get(getNSpace(), Swig_name_member(0, getEnumClassPrefix(), symname)));
 	}
+	// Unless obtained with all the other constants by SWIGConstantsInit
+	if (Getattr(n, "constantsinitvalue")) {
+	  Delete(value);
+	  value = Copy(Getattr(n, "constantsinitvalue"));
+	}
       }
     }
     return value;
@@ -3926,7 +4190,10 @@ public:
     if ((c_ret_type = Swig_typemap_lookup("ctype", n, "", 0))) {
       if (!is_void && !ignored_method) {
 	String *jretval_decl = NewStringf("%s jresult", c_ret_type);
-	Wrapper_add_localv(w, "jresult", jretval_decl, "= 0", NIL);
+	String *jretval_null = Getattr(n, "tmap:ctype:null");
+	String *jretval_init = jretval_null ? NewStringf("= %s", jretval_null) : NewString("= 0");
+	Wrapper_add_localv(w, "jresult", jretval_decl, jretval_init, NIL);
+	Delete(jretval_init);
 	Delete(jretval_decl);
       }
     } else {
@@ -3993,10 +4260,14 @@ public:
 	if (ctypeout)
 	  c_param_type = ctypeout;
 
-	/* Add to local variables */
+	/* Add to local variables, the ctype typemap's null attribute overriding the 0 initializer */
 	Printf(c_decl, "%s %s", c_param_type, arg);
-	if (!ignored_method)
-	  Wrapper_add_localv(w, arg, c_decl, (!(SwigType_ispointer(pt) || SwigType_isreference(pt)) ? "" : "= 0"), NIL);
+	if (!ignored_method) {
+	  String *c_param_null = Getattr(p, "tmap:ctype:null");
+	  String *c_param_init = c_param_null ? NewStringf("= %s", c_param_null) : NewString((SwigType_ispointer(pt) || SwigType_isreference(pt)) ? "= 0" : "");
+	  Wrapper_add_localv(w, arg, c_decl, c_param_init, NIL);
+	  Delete(c_param_init);
+	}
 
 	/* Add input marshalling code */
 	if ((tm = Getattr(p, "tmap:directorin"))) {
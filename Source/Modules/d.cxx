@@ -1753,11 +1753,8 @@ public:
       }
     }
 
-    // Complete D im parameter list and emit the declaration/binding code.
+    // Complete D im parameter list.
     Printv(im_dmodule_parameters, ")", NIL);
-    writeImDModuleFunction(overloaded_name, im_return_type,
-      im_dmodule_parameters, wname);
-    Delete(im_dmodule_parameters);
 
     // Finish C function header.
     Printf(f->def, ") {");
@@ -1807,6 +1804,15 @@ public:
       }
     }
 
+    // Now that it is known whether the function can throw, decide whether it
+    // can be wrapped as »nothrow @nogc« and emit the declaration/binding code.
+    if (d_version > 1 && GetFlag(n, "feature:d:nogc") && isNoGCWrappable(n)) {
+      SetFlag(n, "d:nogc");
+    }
+    writeImDModuleFunction(overloaded_name, im_return_type,
+      im_dmodule_parameters, wname, GetFlag(n, "d:nogc"));
+    Delete(im_dmodule_parameters);
+
     // If we are not processing an enum or constant, and we were not generating
     // a wrapper function which will be accessed via a proxy class, write a
     // function to the proxy D module.
@@ -2583,14 +2589,15 @@ private:
    * parameters - The parameter list of the C wrapper function.
    * wrapper_function_name - The name of the exported function in the C wrapper
    *                         (usually d_name prefixed by »D_«).
+   * nogc - Whether the function is declared as »nothrow @nogc«.
    * --------------------------------------------------------------------------- */
   void writeImDModuleFunction(const_String_or_char_ptr d_name,
     const_String_or_char_ptr return_type, const_String_or_char_ptr parameters,
-    const_String_or_char_ptr wrapper_function_name) {
+    const_String_or_char_ptr wrapper_function_name, bool nogc = false) {
 
     // TODO: Add support for static linking here.
-    Printf(im_dmodule_code, "SwigExternC!(%s function%s) %s;\n", return_type,
-      parameters, d_name);
+    Printf(im_dmodule_code, "%s!(%s function%s) %s;\n",
+      nogc ? "SwigExternCNoGC" : "SwigExternC", return_type, parameters, d_name);
     Printv(wrapper_loader_bind_code, wrapper_loader_bind_command, NIL);
     Replaceall(wrapper_loader_bind_code, "$function", d_name);
     Replaceall(wrapper_loader_bind_code, "$symbol", wrapper_function_name);
@@ -2776,7 +2783,7 @@ private:
 	{
 	  String *proxy_type = NewString("");
 
-	  if ((tm = lookupDTypemap(p, "dtype"))) {
+	  if ((tm = lookupDTypemap(p, "dtype", true))) {
 	    const String *inattributes = Getattr(p, "tmap:dtype:inattributes");
 	    Printf(proxy_type, "%s%s", inattributes ? inattributes : empty_string, tm);
 	  } else {
@@ -2811,6 +2818,10 @@ private:
       Printf(function_code, "const ");
     }
 
+    if (GetFlag(n, "d:nogc")) {
+      Printf(function_code, "nothrow @nogc ");
+    }
+
     // Lookup the code used to convert the wrapper return value to the proxy
     // function return type.
     if ((tm = lookupDTypemap(n, "dout"))) {
@@ -3041,6 +3052,10 @@ private:
       Printf(function_code, "@property ");
     }
 
+    if (GetFlag(n, "d:nogc")) {
+      Printf(function_code, "nothrow @nogc ");
+    }
+
     // Lookup the code used to convert the wrapper return value to the proxy
     // function return type.
     if ((tm = lookupDTypemap(n, "dout"))) {
@@ -4304,6 +4319,79 @@ private:
     Delete(canthrow_attribute);
   }
 
+  /* ---------------------------------------------------------------------------
+   * D::isNoGCWrappable()
+   *
+   * Determines whether the function represented by the passed node, for which
+   * %feature("d:nogc") is enabled, can be wrapped as »nothrow @nogc«. This is
+   * the case if it neither can throw nor calls back into D via directors, and
+   * if neither its return type nor any of its parameters requires allocating
+   * memory on the GC heap. Issues a warning otherwise.
+   * --------------------------------------------------------------------------- */
+  bool isNoGCWrappable(Node *n) {
+    const char *reason = 0;
+    String *type_str = 0;
+    String *return_dtype = 0;
+
+    if (Equal(nodeType(n), "constructor") || Equal(nodeType(n), "destructor")) {
+      // The proxy class constructor and destructor are not plain wrappers.
+      return false;
+    } else if (Getattr(n, "d:canthrow")) {
+      reason = "it can throw a D exception";
+    } else if (Getattr(n, "throws")) {
+      reason = "it has an exception specification";
+    } else if (is_wrapping_class() && Swig_directorclass(getCurrentClass()) && is_member_director(n)) {
+      reason = "it is a director method";
+    } else if (!isNoGCType(n, (return_dtype = lookupDTypemap(n, "dtype")) != 0)) {
+      reason = "the return type is not GC-free";
+      type_str = SwigType_str(Getattr(n, "type"), 0);
+    } else {
+      // The "in" typemaps have already been attached by functionWrapper().
+      ParmList *l = Getattr(n, "parms");
+      Swig_typemap_attach_parms("dtype", l, NULL);
+      for (Parm *p = l; p;) {
+	if (!checkAttribute(p, "tmap:in:numinputs", "0") && !GetFlag(p, "self") &&
+	    !isNoGCType(p, Getattr(p, "tmap:dtype") != 0)) {
+	  reason = "a parameter type is not GC-free";
+	  type_str = SwigType_str(Getattr(p, "type"), 0);
+	  break;
+	}
+	p = Getattr(p, "tmap:in") ? Getattr(p, "tmap:in:next") : nextSibling(p);
+      }
+    }
+
+    if (reason) {
+      Swig_warning(WARN_D_NOGC_IGNORED, input_file, line_number,
+	"%%feature(\"d:nogc\") ignored for %s as %s%s%s%s.\n", Swig_name_decl(n), reason,
+	type_str ? " (" : "", type_str ? type_str : empty_string, type_str ? ")" : "");
+    }
+    Delete(type_str);
+    Delete(return_dtype);
+    return !reason;
+  }
+
+  /* ---------------------------------------------------------------------------
+   * D::isNoGCType()
+   *
+   * Determines whether the type of the given node, for which a dtype typemap
+   * has already been looked up, is passed between D and C without allocating
+   * memory on the GC heap. This is true for primitive types, native pointers
+   * to them and any type whose dtype typemap has the »nogc« attribute set.
+   * --------------------------------------------------------------------------- */
+  bool isNoGCType(Node *n, bool has_dtype) {
+    if (!has_dtype)
+      return false;
+    if (GetFlag(n, "tmap:dtype:cprimitive") || GetFlag(n, "tmap:dtype:nogc"))
+      return true;
+    if (Getattr(n, "tmap:dtype:nativepointer")) {
+      String *dtype = getPrimitiveDptype(n, Getattr(n, "type"));
+      bool nogc = dtype != 0;
+      Delete(dtype);
+      return nogc;
+    }
+    return false;
+  }
+
   /* ---------------------------------------------------------------------------
    * D::wrapMemberFunctionAsDConst()
    *
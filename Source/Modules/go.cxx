@@ -1013,6 +1013,10 @@ private:
 	ret = r;
       }
 
+      if (GetFlag(n, "feature:go:batch")) {
+	Swig_warning(WARN_GO_BATCH, input_file, line_number, "The go:batch feature is only supported with -cgo, no batch wrapper generated for %s.\n", go_name);
+      }
+
       if (!gccgo_flag) {
 	r = gcFunctionWrapper(wname);
 	if (r != SWIG_OK) {
@@ -1120,6 +1124,13 @@ private:
       ret = r;
     }
 
+    if (GetFlag(n, "feature:go:batch")) {
+      r = cgoBatchWrapper(&info);
+      if (r != SWIG_OK) {
+	ret = r;
+      }
+    }
+
     Swig_restore(n);
 
     return ret;
@@ -1593,6 +1604,192 @@ private:
     return SWIG_OK;
   }
 
+  /* ----------------------------------------------------------------------
+   * cgoBatchWrapper()
+   *
+   * Write out the batch wrapper for a function with the go:batch
+   * feature.  The Go function takes a slice of structs holding the
+   * arguments and, for a non-void function, a slice for the results.
+   * It calls the C/C++ function once for each element of the slice,
+   * all in a single cgo call.  The structs and results are passed to
+   * C/C++ without copying, so only functions whose parameters and
+   * result are plain Go numeric or bool types are supported.
+   * ---------------------------------------------------------------------- */
+
+  int cgoBatchWrapper(const cgoWrapperInfo *info) {
+    Node *n = info->n;
+    int parm_count = emit_num_arguments(info->parms);
+    bool has_result = SwigType_type(info->result) != T_VOID;
+
+    const char *reason = NULL;
+    if (info->receiver || info->base || info->is_constructor || info->is_destructor || making_variable_wrappers) {
+      reason = "it is not a function or static method";
+    } else if (info->overname) {
+      reason = "it is overloaded";
+    } else if (parm_count == 0) {
+      reason = "it has no parameters";
+    } else if (parm_count > emit_num_required(info->parms)) {
+      reason = "it has default arguments";
+    } else if (has_result) {
+      Swig_save("cgoBatchWrapper", n, "type", "tmap:goout", NULL);
+      Setattr(n, "type", info->result);
+      String *goout = goTypemapLookup("goout", n, "swig_r");
+      if (!isBatchType(n, info->result) || (goout && Len(goout) > 0)) {
+	reason = "its return type is not a Go numeric or bool type";
+      }
+      Swig_restore(n);
+    }
+
+    Parm *p = info->parms;
+    for (int i = 0; i < parm_count && !reason; ++i) {
+      p = getParm(p);
+      String *goargout = goGetattr(p, "tmap:goargout");
+      if (!isBatchType(p, Getattr(p, "type")) || goGetattr(p, "tmap:goin") || (goargout && Len(goargout) > 0)) {
+	reason = "a parameter type is not a Go numeric or bool type";
+      }
+      p = nextParm(p);
+    }
+
+    if (reason) {
+      Swig_warning(WARN_GO_BATCH, input_file, line_number, "No batch wrapper generated for %s as %s.\n", info->go_name, reason);
+      return SWIG_OK;
+    }
+
+    String *batch_name = NewStringf("%sBatch", info->go_name);
+    String *args_name = NewStringf("%sBatchArgs", info->go_name);
+    String *batch_wname = NewStringf("%s_batch", info->wname);
+    String *args_cname = NewStringf("%s_batch_args", info->wname);
+    String *result_gotype = has_result ? goType(n, info->result) : NULL;
+
+    // The Go struct holding the arguments of one call.
+    Printv(f_go_wrappers, "type ", args_name, " struct {\n", NULL);
+    Hash *field_names = NewHash();
+    p = info->parms;
+    for (int i = 0; i < parm_count; ++i) {
+      p = getParm(p);
+      String *name = Getattr(p, "name");
+      String *field = name ? exportedName(name) : NULL;
+      if (!field || Getattr(field_names, field)) {
+	Delete(field);
+	field = NewStringf("Arg%d", i + 1);
+      }
+      Setattr(field_names, field, field);
+      String *tm = goType(p, Getattr(p, "type"));
+      Printv(f_go_wrappers, "\t", field, " ", tm, "\n", NULL);
+      Delete(tm);
+      Delete(field);
+      p = nextParm(p);
+    }
+    Delete(field_names);
+    Printv(f_go_wrappers, "}\n\n", NULL);
+
+    // The Go function.
+    Printv(f_go_wrappers, "func ", batch_name, "(args []", args_name, NULL);
+    if (has_result) {
+      Printv(f_go_wrappers, ", results []", result_gotype, NULL);
+    }
+    Printv(f_go_wrappers, ") {\n", NULL);
+    Printv(f_go_wrappers, "\tif len(args) == 0 {\n", NULL);
+    Printv(f_go_wrappers, "\t\treturn\n", NULL);
+    Printv(f_go_wrappers, "\t}\n", NULL);
+    if (has_result) {
+      Printv(f_go_wrappers, "\tif len(results) < len(args) {\n", NULL);
+      Printv(f_go_wrappers, "\t\tpanic(\"", batch_name, ": results is shorter than args\")\n", NULL);
+      Printv(f_go_wrappers, "\t}\n", NULL);
+    }
+    Printv(f_go_wrappers, "\tC.", batch_wname, "(C.swig_voidp(unsafe.Pointer(&args[0])), ", NULL);
+    if (has_result) {
+      Printv(f_go_wrappers, "C.swig_voidp(unsafe.Pointer(&results[0])), ", NULL);
+    }
+    Printv(f_go_wrappers, "C.swig_intgo(len(args)))\n", NULL);
+    Printv(f_go_wrappers, "}\n\n", NULL);
+
+    // The cgo declaration.
+    Printv(f_cgo_comment, "extern void ", batch_wname, "(swig_voidp _swig_args, ", has_result ? "swig_voidp _swig_results, " : "", "swig_intgo _swig_n);\n", NULL);
+
+    // The C/C++ function, which calls the C/C++ wrapper for each
+    // element.  The struct must have the same layout as the Go
+    // struct: Go aligns 8 byte types to 4 bytes on 32-bit targets.
+    if (intgo_type_size == 32) {
+      Printv(f_c_wrappers, "#pragma pack(push, 4)\n", NULL);
+    }
+    Printv(f_c_wrappers, "typedef struct {\n", NULL);
+    String *call = NewStringf("%s(", info->wname);
+    p = info->parms;
+    for (int i = 0; i < parm_count; ++i) {
+      p = getParm(p);
+      String *pn = NewStringf("_swig_go_%d", i);
+      String *ct = gcCTypeForGoValue(p, Getattr(p, "type"), pn);
+      Printv(f_c_wrappers, "  ", ct, ";\n", NULL);
+      Printv(call, i > 0 ? ", " : "", "args[i].", pn, NULL);
+      Delete(ct);
+      Delete(pn);
+      p = nextParm(p);
+    }
+    Printv(call, ")", NULL);
+    Printv(f_c_wrappers, "} ", args_cname, ";\n", NULL);
+    if (intgo_type_size == 32) {
+      Printv(f_c_wrappers, "#pragma pack(pop)\n", NULL);
+    }
+    Printv(f_c_wrappers, "\n", NULL);
+
+    Printv(f_c_wrappers, "void ", batch_wname, "(void *_swig_go_args, ", has_result ? "void *_swig_go_results, " : "", "intgo _swig_go_n) {\n", NULL);
+    Printv(f_c_wrappers, "  const ", args_cname, " *args = (const ", args_cname, " *)_swig_go_args;\n", NULL);
+    if (has_result) {
+      String *rn = NewString("*results");
+      String *ct = gcCTypeForGoValue(n, info->result, rn);
+      String *pn = NewString("*");
+      String *cast = gcCTypeForGoValue(n, info->result, pn);
+      Printv(f_c_wrappers, "  ", ct, " = (", cast, ")_swig_go_results;\n", NULL);
+      Delete(cast);
+      Delete(pn);
+      Delete(ct);
+      Delete(rn);
+    }
+    Printv(f_c_wrappers, "  intgo i;\n", NULL);
+    Printv(f_c_wrappers, "  for (i = 0; i < _swig_go_n; ++i) {\n", NULL);
+    Printv(f_c_wrappers, "    ", has_result ? "results[i] = " : "", call, ";\n", NULL);
+    Printv(f_c_wrappers, "  }\n", NULL);
+    Printv(f_c_wrappers, "}\n\n", NULL);
+
+    Delete(call);
+    Delete(result_gotype);
+    Delete(args_cname);
+    Delete(batch_wname);
+    Delete(args_name);
+    Delete(batch_name);
+
+    return SWIG_OK;
+  }
+
+  /* ----------------------------------------------------------------------
+   * isBatchType()
+   *
+   * Return whether a value of this type can be passed to or returned
+   * from a batch wrapper: the Go type must be a plain numeric or bool
+   * type, which C/C++ can read and write in Go memory.
+   * ---------------------------------------------------------------------- */
+
+  bool isBatchType(Node *n, SwigType *type) {
+    static const char *batch_types[] = { "bool", "int8", "uint8", "byte", "int16", "uint16", "int32", "uint32", "int64", "uint64", "int", "uint", "float32", "float64", NULL };
+    bool is_interface;
+    String *gt = goTypeWithInfo(n, type, false, &is_interface);
+    String *imt = goImType(n, type);
+    bool ret = !is_interface && Cmp(gt, imt) == 0;
+    if (ret) {
+      ret = false;
+      for (const char **bt = batch_types; *bt; ++bt) {
+	if (Cmp(gt, *bt) == 0) {
+	  ret = true;
+	  break;
+	}
+      }
+    }
+    Delete(imt);
+    Delete(gt);
+    return ret;
+  }
+
   /* ----------------------------------------------------------------------
    * goFunctionWrapper()
    *
@@ -89,6 +89,17 @@ class JAVA:public Language {
   int curr_class_dmethod;
   int nesting_depth;
 
+  // JNI IDs used through the $javaclassref, $javamethodref... special variables
+  List *javarefs_classes;	// class names
+  List *javarefs_methods;	// method IDs, each a hash with the class index, name, signature and static flag
+  List *javarefs_fields;	// field IDs, same as methods
+  Hash *javarefs_index;		// special variable arguments to the index of the ID
+
+  // Constants obtained all at once by swig_constants_init, see constantsInitValue()
+  String *constants_init_code;	// C code filling in the values
+  int n_constants_init;		// number of values
+  enum { ConstantsInitChunk = 64 };	// values copied to the Java array at a time
+
   enum EnumFeature { SimpleEnum, TypeunsafeEnum, TypesafeEnum, ProperEnum };
 
 public:
@@ -158,7 +169,13 @@ public:
       n_directors(0),
       first_class_dmethod(0),
       curr_class_dmethod(0),
-      nesting_depth(0){
+      nesting_depth(0),
+      javarefs_classes(NULL),
+      javarefs_methods(NULL),
+      javarefs_fields(NULL),
+      javarefs_index(NULL),
+      constants_init_code(NULL),
+      n_constants_init(0){
     /* for now, multiple inheritance in directors is disabled, this
        should be easy to implement though */
     director_multiple_inheritance = 0;
@@ -386,6 +403,12 @@ public:
 
     swig_types_hash = NewHash();
     filenames_list = NewList();
+    javarefs_classes = NewList();
+    javarefs_methods = NewList();
+    javarefs_fields = NewList();
+    javarefs_index = NewHash();
+    constants_init_code = NewString("");
+    n_constants_init = 0;
 
     // Make the intermediary class and module class names. The intermediary class name can be set in the module directive.
     if (!imclass_name) {
@@ -486,11 +509,22 @@ public:
     /* Emit code */
     Language::top(n);
 
+    String *director_runtime = NewString("");
     if (directorsEnabled()) {
       // Insert director runtime into the f_runtime file (make it occur before %header section)
-      Swig_insert_file("director_common.swg", f_runtime);
-      Swig_insert_file("director.swg", f_runtime);
+      Swig_insert_file("director_common.swg", director_runtime);
+      Swig_insert_file("director.swg", director_runtime);
     }
+
+    // Replace the JNI ID special variables in the generated C/C++ code, including the director runtime, which follows their declarations
+    substituteJavaRefs(director_runtime);
+    substituteJavaRefs(f_header);
+    substituteJavaRefs(f_directors);
+    substituteJavaRefs(f_wrappers);
+    substituteJavaRefs(f_init);
+    emitJavaRefsDeclarations();
+    Printv(f_runtime, director_runtime, NIL);
+    Delete(director_runtime);
     // Generate the intermediary class
     {
       String *filen = NewStringf("%s%s.java", outputDirectory(imclass_package), imclass_name);
@@ -534,13 +568,21 @@ public:
       if (Len(imclass_directors) > 0)
 	Printv(f_im, "\n", imclass_directors, NIL);
 
-      if (n_dmethods > 0) {
+      if (n_dmethods > 0 || hasJavaRefs()) {
 	Putc('\n', f_im);
 	Printf(f_im, "  private final static native void swig_module_init();\n");
 	Printf(f_im, "  static {\n");
 	Printf(f_im, "    swig_module_init();\n");
 	Printf(f_im, "  }\n");
       }
+      if (n_constants_init > 0) {
+	Putc('\n', f_im);
+	Printf(f_im, "  private final static native long[] swig_constants_init();\n");
+	Printf(f_im, "  private final static long[] swig_constants = swig_constants_init();\n");
+	Printf(f_im, "  public final static long swig_constant(int index) {\n");
+	Printf(f_im, "    return swig_constants[index];\n");
+	Printf(f_im, "  }\n");
+      }
       // Finish off the class
       Printf(f_im, "}\n");
       Delete(f_im);
@@ -633,6 +675,7 @@ public:
       Printv(f_wrappers, upcasts_code, NIL);
 
     emitDirectorUpcalls();
+    emitConstantsInit();
 
     Printf(f_wrappers, "#ifdef __cplusplus\n");
     Printf(f_wrappers, "}\n");
@@ -717,6 +760,17 @@ public:
     Delete(dmethods_table);
     dmethods_table = NULL;
     n_dmethods = 0;
+    Delete(javarefs_classes);
+    javarefs_classes = NULL;
+    Delete(javarefs_methods);
+    javarefs_methods = NULL;
+    Delete(javarefs_fields);
+    javarefs_fields = NULL;
+    Delete(javarefs_index);
+    javarefs_index = NULL;
+    Delete(constants_init_code);
+    constants_init_code = NULL;
+    n_constants_init = 0;
 
     /* Close all of the files */
     Dump(f_header, f_runtime);
@@ -992,28 +1046,34 @@ public:
     Printv(f->code, nondir_args, NIL);
     Delete(nondir_args);
 
-    /* Insert constraint checking code */
+    /* Insert constraint checking code. The check typemaps of the arguments whose freearg typemap has the
+       'critical' attribute enter a JNI critical region, so they come after all the others, which may make JNI calls. */
+    String *critical_check = NewString("");
     for (p = l; p;) {
       if ((tm = Getattr(p, "tmap:check"))) {
 	addThrows(n, "tmap:check", p);
 	Replaceall(tm, "$target", Getattr(p, "lname"));	/* deprecated */
 	Replaceall(tm, "$arg", Getattr(p, "emit:input"));	/* deprecated? */
 	Replaceall(tm, "$input", Getattr(p, "emit:input"));
-	Printv(f->code, tm, "\n", NIL);
+	Printv(Getattr(p, "tmap:freearg:critical") ? critical_check : f->code, tm, "\n", NIL);
 	p = Getattr(p, "tmap:check:next");
       } else {
 	p = nextSibling(p);
       }
     }
+    Printv(f->code, critical_check, NIL);
+    Delete(critical_check);
 
-    /* Insert cleanup code */
+    /* Insert cleanup code. The freearg typemaps with the 'critical' attribute leave the JNI critical region, so they
+       are emitted straight after the wrapped function is called, before any other code making JNI calls. */
+    String *critical_cleanup = NewString("");
     for (p = l; p;) {
       if ((tm = Getattr(p, "tmap:freearg"))) {
 	addThrows(n, "tmap:freearg", p);
 	Replaceall(tm, "$source", Getattr(p, "emit:input"));	/* deprecated */
 	Replaceall(tm, "$arg", Getattr(p, "emit:input"));	/* deprecated? */
 	Replaceall(tm, "$input", Getattr(p, "emit:input"));
-	Printv(cleanup, tm, "\n", NIL);
+	Printv(Getattr(p, "tmap:freearg:critical") ? critical_cleanup : cleanup, tm, "\n", NIL);
 	p = Getattr(p, "tmap:freearg:next");
       } else {
 	p = nextSibling(p);
@@ -1056,6 +1116,13 @@ public:
       // Handle exception classes specified in the "except" feature's "throws" attribute
       addThrows(n, "feature:except", n);
 
+      // The exception handling code returns without leaving the JNI critical region, an except feature of "1" is not used, see emit_action_code()
+      String *except = GetFlagAttr(n, "feature:except");
+      if (Len(critical_cleanup) > 0 && ((except && Len(except) && Strcmp(except, "1") != 0) || throw_parm_list)) {
+	Swig_warning(WARN_JAVA_CRITICAL_EXCEPTION, input_file, line_number,
+		     "The JNI critical region entered for the arguments of %s is not left when %%exception or a throws typemap returns early.\n", Swig_name_decl(n));
+      }
+
       /* Return value if necessary  */
       if ((tm = Swig_typemap_lookup_out("out", n, Swig_cresult_name(), f, actioncode))) {
 	addThrows(n, "tmap:out", n);
@@ -1068,10 +1135,17 @@ public:
         else
           Replaceall(tm, "$owner", "0");
 
+	// The wrapped function is called in the out typemap itself when the optimal attribute is used
+	bool optimal = Getattr(n, "tmap:out:optimal") != 0;
+	if (!optimal)
+	  Printv(f->code, critical_cleanup, NIL);
 	Printf(f->code, "%s", tm);
 	if (Len(tm))
 	  Printf(f->code, "\n");
+	if (optimal)
+	  Printv(f->code, critical_cleanup, NIL);
       } else {
+	Printv(f->code, critical_cleanup, NIL);
 	Swig_warning(WARN_TYPEMAP_OUT_UNDEF, input_file, line_number, "Unable to use return type %s in function %s.\n", SwigType_str(t, 0), Getattr(n, "name"));
       }
       emit_return_variable(n, t, f);
@@ -1112,8 +1186,10 @@ public:
       Printv(f->code, "    return jresult;\n", NIL);
     Printf(f->code, "}\n");
 
-    /* Substitute the cleanup code */
+    /* Substitute the cleanup code, which leaves the JNI critical region first when returning before the wrapped function is called */
+    Insert(cleanup, 0, critical_cleanup);
     Replaceall(f->code, "$cleanup", cleanup);
+    Delete(critical_cleanup);
 
     /* Substitute the function name */
     Replaceall(f->code, "$symname", symname);
@@ -1387,6 +1463,13 @@ public:
       String *val = NewStringf("'%(escape)s'", Getattr(n, "enumvalue"));
       Setattr(n, "enumvalue", val);
       Delete(val);
+    } else {
+      // The value evaluated by SWIG is used instead of the C syntax by %javaconst(1), see enumValue()
+      String *foldedvalue = fold_enum_value(n);
+      if (foldedvalue) {
+	Setattr(n, "foldedvalue", foldedvalue);
+	Delete(foldedvalue);
+      }
     }
 
     {
@@ -1518,6 +1601,9 @@ public:
 
     // The %javaconst feature determines how the constant value is obtained
     int const_feature_flag = GetFlag(n, "feature:java:const");
+    // A value which overflows is obtained from C/C++ as its C expression would not give the same Java value
+    if (const_feature_flag && !is_enum_item && fold_constant_overflow(n))
+      const_feature_flag = 0;
 
     /* Adjust the enum type for the Swig_typemap_lookup.
      * We want the same jstype typemap for all the enum items so we use the enum type (parent node). */
@@ -1561,8 +1647,19 @@ public:
       Printf(constants_code, "%s;\n", value);
     } else if (!const_feature_flag) {
       // Default enum and constant handling will work with any type of C constant and initialises the Java variable from C through a JNI call.
+      // Constants of the primitive types are all obtained by a single JNI call, see constantsInitValue().
+      bool is_enum = is_enum_item || SwigType_isenum(t);
+      String *initvalue = (!classname_substituted_flag || is_enum) ? constantsInitValue(n, t, is_enum) : 0;
 
-      if (classname_substituted_flag) {
+      if (initvalue) {
+	if (classname_substituted_flag)
+	  Printf(constants_code, "%s.swigToEnum(%s);\n", return_type, initvalue);
+	else
+	  Printf(constants_code, "%s;\n", initvalue);
+	// Used by enumValue()
+	Setattr(n, "constantsinitvalue", initvalue);
+	Delete(initvalue);
+      } else if (classname_substituted_flag) {
 	if (SwigType_isenum(t)) {
 	  // This handles wrapping of inline initialised const enum static member variables (not when wrapping enum items - ignored later on)
 	  Printf(constants_code, "%s.swigToEnum(%s.%s());\n", return_type, full_imclass_name, Swig_name_get(getNSpace(), symname));
@@ -1574,21 +1671,30 @@ public:
 	Printf(constants_code, "%s.%s();\n", full_imclass_name ? full_imclass_name : imclass_name, Swig_name_get(getNSpace(), symname));
       }
 
-      // Each constant and enum value is wrapped with a separate JNI function call
-      SetFlag(n, "feature:immutable");
-      enum_constant_flag = true;
-      variableWrapper(n);
-      enum_constant_flag = false;
+      if (!initvalue) {
+	// Each remaining constant and enum value is wrapped with a separate JNI function call
+	SetFlag(n, "feature:immutable");
+	enum_constant_flag = true;
+	variableWrapper(n);
+	enum_constant_flag = false;
+      }
     } else {
-      // Alternative constant handling will use the C syntax to make a true Java constant and hope that it compiles as Java code
+      // Alternative constant handling will use the C syntax to make a true Java constant and hope that it compiles as Java code,
+      // unless the value of an integral constant can be evaluated by SWIG
+      String *foldedvalue = 0;
       if (Getattr(n, "wrappedasconstant")) {
 	if (SwigType_type(valuetype) == T_CHAR)
           Printf(constants_code, "\'%(escape)s\';\n", Getattr(n, "staticmembervariableHandler:value"));
+	else if ((foldedvalue = foldConstantValue(Getattr(n, "staticmembervariableHandler:value"), t)))
+          Printf(constants_code, "%s;\n", foldedvalue);
 	else
           Printf(constants_code, "%s;\n", Getattr(n, "staticmembervariableHandler:value"));
+      } else if (!is_enum_item && (foldedvalue = foldConstantValue(Getattr(n, "value"), t))) {
+        Printf(constants_code, "%s;\n", foldedvalue);
       } else {
         Printf(constants_code, "%s;\n", Getattr(n, "value"));
       }
+      Delete(foldedvalue);
     }
 
     // Emit the generated code to appropriate place
@@ -1607,6 +1713,94 @@ public:
     return SWIG_OK;
   }
 
+  /* -----------------------------------------------------------------------
+   * foldConstantValue()
+   * Returns the value of an integral constant expression as evaluated by SWIG
+   * as a Java literal or NULL if it cannot be evaluated.
+   * ------------------------------------------------------------------------ */
+
+  String *foldConstantValue(String *expr, SwigType *t) {
+    String *value = fold_constant_value(expr, t, 0);
+    // The types wrapped as a Java long need a long literal
+    int type = SwigType_type(t);
+    if (value && (type == T_UINT || type == T_ULONG || type == T_LONGLONG))
+      Append(value, "L");
+    return value;
+  }
+
+  /* -----------------------------------------------------------------------
+   * constantsInitValue()
+   * Adds a constant of a primitive type, or an enum, to the values obtained
+   * all at once by the swig_constants_init JNI call when the intermediary
+   * class is loaded, instead of using a JNI call per constant.
+   * Returns the Java expression for the value or NULL if the type is not supported.
+   * ------------------------------------------------------------------------ */
+
+  String *constantsInitValue(Node *n, SwigType *t, bool is_enum) {
+    switch (is_enum ? T_INT : SwigType_type(t)) {
+    case T_BOOL:
+    case T_SCHAR:
+    case T_UCHAR:
+    case T_SHORT:
+    case T_USHORT:
+    case T_INT:
+    case T_UINT:
+    case T_LONG:
+    case T_ULONG:
+    case T_LONGLONG:
+    case T_FLOAT:
+    case T_DOUBLE:
+      break;
+    default:
+      return 0;
+    }
+
+    // Only the default typemaps are supported, the values are passed as a jlong or as the bits of a jdouble
+    static const char *primitives[][3] = {
+      { "jboolean", "boolean", "%s != 0" },
+      { "jbyte", "byte", "(byte)%s" },
+      { "jshort", "short", "(short)%s" },
+      { "jint", "int", "(int)%s" },
+      { "jlong", "long", "%s" },
+      { "jfloat", "float", "(float)Double.longBitsToDouble(%s)" },
+      { "jdouble", "double", "Double.longBitsToDouble(%s)" }
+    };
+    String *jni = Swig_typemap_lookup("jni", n, "", 0);
+    String *jtype = Swig_typemap_lookup("jtype", n, "", 0);
+    int i;
+    for (i = 0; i < (int)(sizeof(primitives)/sizeof(primitives[0])); i++) {
+      if (Equal(jni, primitives[i][0]) && Equal(jtype, primitives[i][1]))
+	break;
+    }
+    if (i == (int)(sizeof(primitives)/sizeof(primitives[0])))
+      return 0;
+
+    // Same C expression as the constant's getter generated by variableWrapper()
+    String *cvalue = 0;
+    if (Equal(nodeType(n), "constant"))
+      cvalue = NewStringf("(%s)", Getattr(n, "rawval") ? Getattr(n, "rawval") : Getattr(n, "value"));
+    else
+      cvalue = SwigType_namestr(Getattr(n, "name"));
+    SwigType *lt = SwigType_ltype(t);
+    String *ctype = SwigType_str(lt, 0);
+    int index = n_constants_init % ConstantsInitChunk;
+    if (Equal(jni, "jfloat") || Equal(jni, "jdouble"))
+      Printf(constants_init_code, "{\njdouble d = (jdouble)(%s)%s;\nmemcpy(&values[%d], &d, sizeof(d));\n}\n", ctype, cvalue, index);
+    else
+      Printf(constants_init_code, "values[%d] = (jlong)(%s)%s;\n", index, ctype, cvalue);
+    if (index == ConstantsInitChunk - 1)
+      emitConstantsInitCopy(constants_init_code, n_constants_init + 1);
+
+    String *element = NewStringf("%s.swig_constant(%d)", full_imclass_name ? full_imclass_name : imclass_name, n_constants_init);
+    String *value = NewStringf(primitives[i][2], element);
+    n_constants_init++;
+    Delete(element);
+    Delete(ctype);
+    Delete(lt);
+    Delete(cvalue);
+    return value;
+  }
+
   /* -----------------------------------------------------------------------------
    * insertDirective()
    * ----------------------------------------------------------------------------- */
@@ -3149,8 +3343,11 @@ public:
       int const_feature_flag = GetFlag(n, "feature:java:const");
 
       if (const_feature_flag) {
-	// Use the C syntax to make a true Java constant and hope that it compiles as Java code
-	value = Getattr(n, "enumvalue") ? Copy(Getattr(n, "enumvalue")) : Copy(Getattr(n, "enumvalueex"));
+	// Use the value evaluated by SWIG, otherwise the C syntax to make a true Java constant and hope that it compiles as Java code
+	if (Getattr(n, "foldedvalue"))
+	  value = Copy(Getattr(n, "foldedvalue"));
+	else
+	  value = Getattr(n, "enumvalue") ? Copy(Getattr(n, "enumvalue")) : Copy(Getattr(n, "enumvalueex"));
       } else {
 	String *newsymname = 0;
 	if (!getCurrentClass() || !proxy_flag) {
@@ -3172,6 +3369,11 @@ public:
 	  memberconstantHandler(n);
 	  value = NewStringf("%s.%s()", full_imclass_name ? full_imclass_name : imclass_name, Swig_name_get(getNSpace(), Swig_name_member(0, getEnumClassPrefix(), symname)));
 	}
+	// Unless obtained with all the other constants by swig_constants_init
+	if (Getattr(n, "constantsinitvalue")) {
+	  Delete(value);
+	  value = Copy(Getattr(n, "constantsinitvalue"));
+	}
 	Delete(newsymname);
       }
     }
@@ -3655,12 +3857,226 @@ public:
     return NULL;
   }
 
+  /* -----------------------------------------------------------------------------
+   * substituteJavaRefs()
+   *
+   * Replace the special variables for JNI IDs in C/C++ code:
+   *   $javaclassref("class")
+   *   $javamethodref("class", "name", "signature")
+   *   $javastaticmethodref("class", "name", "signature")
+   *   $javafieldref("class", "name", "signature")
+   *   $javastaticfieldref("class", "name", "signature")
+   * with a global reference to the class or the method or field ID, which
+   * swig_module_init looks up once when the intermediary class is loaded.
+   * ----------------------------------------------------------------------------- */
+
+  void substituteJavaRefs(String *code) {
+    static const char *specialvars[] = { "$javaclassref", "$javamethodref", "$javastaticmethodref", "$javafieldref", "$javastaticfieldref" };
+    if (!Strstr(code, "$java"))
+      return;
+
+    String *result = NewStringEmpty();
+    const char *c = Char(code);
+    const char *s;
+    while ((s = strstr(c, "$java"))) {
+      int kind = -1;
+      const char *e = 0;
+      for (int k = 0; k < (int) (sizeof(specialvars) / sizeof(specialvars[0])); ++k) {
+	size_t len = strlen(specialvars[k]);
+	if (strncmp(s, specialvars[k], len) == 0 && s[len] == '(') {
+	  kind = k;
+	  e = s + len + 1;
+	}
+      }
+      Write(result, c, (int) (s - c));
+      if (kind < 0) {
+	Write(result, s, 5);
+	c = s + 5;
+	continue;
+      }
+
+      // Arguments are string literals
+      List *args = NewList();
+      bool ok = false;
+      for (;;) {
+	while (isspace((unsigned char) *e))
+	  ++e;
+	if (*e != '"')
+	  break;
+	const char *q = strchr(e + 1, '"');
+	if (!q)
+	  break;
+	String *arg = NewStringWithSize(e + 1, (int) (q - e - 1));
+	Append(args, arg);
+	Delete(arg);
+	e = q + 1;
+	while (isspace((unsigned char) *e))
+	  ++e;
+	if (*e == ')') {
+	  ok = true;
+	  ++e;
+	  break;
+	}
+	if (*e != ',')
+	  break;
+	++e;
+      }
+      if (!ok || Len(args) != (kind == 0 ? 1 : 3)) {
+	Swig_error(input_file, line_number, "Invalid %s special variable, the arguments must be %s.\n", specialvars[kind],
+		   kind == 0 ? "the class name" : "the class name, member name and signature as string literals");
+	Write(result, s, (int) (e - s));
+	c = e;
+	Delete(args);
+	continue;
+      }
+
+      int clazz = javaRefIndex(javarefs_classes, NewStringf("%s", Getitem(args, 0)), 0);
+      if (kind == 0) {
+	Printf(result, "SWIG_JavaClassRefs[%d]", clazz);
+      } else {
+	Hash *member = NewHash();
+	Setattr(member, "class", NewStringf("%d", clazz));
+	Setattr(member, "name", Getitem(args, 1));
+	Setattr(member, "signature", Getitem(args, 2));
+	bool is_static = kind == 2 || kind == 4;
+	if (is_static)
+	  SetFlag(member, "static");
+	String *key = NewStringf("%s:%d:%s:%s", is_static ? "static" : "", clazz, Getitem(args, 1), Getitem(args, 2));
+	if (kind <= 2)
+	  Printf(result, "SWIG_JavaMethodRefs[%d]", javaRefIndex(javarefs_methods, key, member));
+	else
+	  Printf(result, "SWIG_JavaFieldRefs[%d]", javaRefIndex(javarefs_fields, key, member));
+      }
+      c = e;
+      Delete(args);
+    }
+    Append(result, c);
+    Clear(code);
+    Append(code, result);
+    Delete(result);
+  }
+
+  /* -----------------------------------------------------------------------------
+   * javaRefIndex()
+   *
+   * Index of the JNI ID with the given key in refs, adding it if needed.
+   * The item added is the key itself if item is NULL. Takes ownership of key.
+   * ----------------------------------------------------------------------------- */
+
+  int javaRefIndex(List *refs, String *key, Hash *item) {
+    String *index_key = NewStringf("%s|%s", refs == javarefs_classes ? "class" : refs == javarefs_methods ? "method" : "field", key);
+    String *index = Getattr(javarefs_index, index_key);
+    int i;
+    if (index) {
+      i = atoi(Char(index));
+      Delete(item);
+    } else {
+      i = Len(refs);
+      Append(refs, item ? item : key);
+      Setattr(javarefs_index, index_key, NewStringf("%d", i));
+      Delete(item);
+    }
+    Delete(index_key);
+    Delete(key);
+    return i;
+  }
+
+  /* -----------------------------------------------------------------------------
+   * hasJavaRefs()
+   * ----------------------------------------------------------------------------- */
+
+  bool hasJavaRefs() const {
+    return Len(javarefs_classes) > 0;
+  }
+
+  /* -----------------------------------------------------------------------------
+   * emitJavaRefsDeclarations()
+   * ----------------------------------------------------------------------------- */
+
+  void emitJavaRefsDeclarations() {
+    if (!hasJavaRefs())
+      return;
+    Printf(f_runtime, "\n/* JNI IDs looked up by swig_module_init */\n");
+    Printf(f_runtime, "static jclass SWIG_JavaClassRefs[%d];\n", Len(javarefs_classes));
+    if (Len(javarefs_methods) > 0)
+      Printf(f_runtime, "static jmethodID SWIG_JavaMethodRefs[%d];\n", Len(javarefs_methods));
+    if (Len(javarefs_fields) > 0)
+      Printf(f_runtime, "static jfieldID SWIG_JavaFieldRefs[%d];\n", Len(javarefs_fields));
+    Printf(f_runtime, "\n");
+  }
+
+  /* -----------------------------------------------------------------------------
+   * emitJavaRefsLookup()
+   *
+   * Emit the code looking up the JNI IDs into swig_module_init. A missing class
+   * or member leaves its NoClassDefFoundError, NoSuchMethodError or
+   * NoSuchFieldError pending, so it is thrown from the static initializer of
+   * the intermediary class.
+   * ----------------------------------------------------------------------------- */
+
+  void emitJavaRefsLookup(Wrapper *w) {
+    Iterator it;
+    const char *kinds[] = { "Method", "Field" };
+    List *members[] = { javarefs_methods, javarefs_fields };
+
+    // Equivalent of the JCALL macros, which are only expanded by the SWIG preprocessor
+    const char *jcall = CPlusPlus ? "jenv->" : "(*jenv)->";
+    const char *jenvarg = CPlusPlus ? "" : "jenv, ";
+
+    Printf(w->code, "{\n");
+    Printf(w->code, "static const char *classrefs[%d] = {\n", Len(javarefs_classes));
+    for (it = First(javarefs_classes); it.item; it = Next(it))
+      Printf(w->code, "  \"%s\"%s\n", it.item, Len(javarefs_classes) - 1 == it._index ? "" : ",");
+    Printf(w->code, "};\n");
+    Printf(w->code, "for (i = 0; i < %d; ++i) {\n", Len(javarefs_classes));
+    Printf(w->code, "  jclass clazz = %sFindClass(%sclassrefs[i]);\n", jcall, jenvarg);
+    Printf(w->code, "  if (!clazz) return;\n");
+    Printf(w->code, "  SWIG_JavaClassRefs[i] = (jclass) %sNewGlobalRef(%sclazz);\n", jcall, jenvarg);
+    Printf(w->code, "  %sDeleteLocalRef(%sclazz);\n", jcall, jenvarg);
+    Printf(w->code, "  if (!SWIG_JavaClassRefs[i]) {\n");
+    Printf(w->code, "    SWIG_JavaThrowException(jenv, SWIG_JavaOutOfMemoryError, \"Cannot create a global reference to a class used by the module\");\n");
+    Printf(w->code, "    return;\n");
+    Printf(w->code, "  }\n");
+    Printf(w->code, "}\n");
+
+    for (int k = 0; k < 2; ++k) {
+      List *refs = members[k];
+      if (Len(refs) == 0)
+	continue;
+      Printf(w->code, "{\n");
+      Printf(w->code, "  static const struct {\n");
+      Printf(w->code, "    int clazz;\n");
+      Printf(w->code, "    const char *name;\n");
+      Printf(w->code, "    const char *signature;\n");
+      Printf(w->code, "    int is_static;\n");
+      Printf(w->code, "  } refs[%d] = {\n", Len(refs));
+      for (it = First(refs); it.item; it = Next(it))
+	Printf(w->code, "    { %s, \"%s\", \"%s\", %d }%s\n", Getattr(it.item, "class"), Getattr(it.item, "name"), Getattr(it.item, "signature"),
+	       GetFlag(it.item, "static") ? 1 : 0, Len(refs) - 1 == it._index ? "" : ",");
+      Printf(w->code, "  };\n");
+      Printf(w->code, "  for (i = 0; i < %d; ++i) {\n", Len(refs));
+      Printf(w->code, "    jclass clazz = SWIG_JavaClassRefs[refs[i].clazz];\n");
+      Printf(w->code, "    if (refs[i].is_static) {\n");
+      Printf(w->code, "      SWIG_Java%sRefs[i] = %sGetStatic%sID(%sclazz, refs[i].name, refs[i].signature);\n", kinds[k], jcall, kinds[k], jenvarg);
+      Printf(w->code, "    } else {\n");
+      Printf(w->code, "      SWIG_Java%sRefs[i] = %sGet%sID(%sclazz, refs[i].name, refs[i].signature);\n", kinds[k], jcall, kinds[k], jenvarg);
+      Printf(w->code, "    }\n");
+      Printf(w->code, "    if (!SWIG_Java%sRefs[i]) return;\n", kinds[k]);
+      Printf(w->code, "  }\n");
+      Printf(w->code, "}\n");
+    }
+    Printf(w->code, "}\n");
+  }
+
   /*----------------------------------------------------------------------
    * emitDirectorUpcalls()
+   *
+   * Emit swig_module_init, which looks up the director upcall method IDs and
+   * the JNI IDs used through the special variables, see substituteJavaRefs().
    *--------------------------------------------------------------------*/
 
   void emitDirectorUpcalls() {
-    if (n_dmethods) {
+    if (n_dmethods || hasJavaRefs()) {
       Wrapper *w = NewWrapper();
       String *jni_imclass_name = makeValidJniName(imclass_name);
       String *swig_module_init = NewString("swig_module_init");
@@ -3682,29 +4098,41 @@ public:
 	Putc('\n', dmethod_data);
       }
 
-      Printf(f_runtime, "namespace Swig {\n");
-      Printf(f_runtime, "  namespace {\n");
-      Printf(f_runtime, "    jclass jclass_%s = NULL;\n", imclass_name);
-      Printf(f_runtime, "    jmethodID director_method_ids[%d];\n", n_methods);
-      Printf(f_runtime, "  }\n");
-      Printf(f_runtime, "}\n");
+      if (n_methods) {
+	Printf(f_runtime, "namespace Swig {\n");
+	Printf(f_runtime, "  namespace {\n");
+	Printf(f_runtime, "    jclass jclass_%s = NULL;\n", imclass_name);
+	Printf(f_runtime, "    jmethodID director_method_ids[%d];\n", n_methods);
+	Printf(f_runtime, "  }\n");
+	Printf(f_runtime, "}\n");
+      }
 
       Printf(w->def, "SWIGEXPORT void JNICALL Java_%s%s_%s(JNIEnv *jenv, jclass jcls) {", jnipackage, jni_imclass_name, swig_module_init_jni);
-      Printf(w->code, "static struct {\n");
-      Printf(w->code, "  const char *method;\n");
-      Printf(w->code, "  const char *signature;\n");
-      Printf(w->code, "} methods[%d] = {\n", n_methods);
-      Printv(w->code, dmethod_data, NIL);
-      Printf(w->code, "};\n");
-
       Wrapper_add_local(w, "i", "int i");
 
-      Printf(w->code, "Swig::jclass_%s = (jclass) jenv->NewGlobalRef(jcls);\n", imclass_name);
-      Printf(w->code, "if (!Swig::jclass_%s) return;\n", imclass_name);
-      Printf(w->code, "for (i = 0; i < (int) (sizeof(methods)/sizeof(methods[0])); ++i) {\n");
-      Printf(w->code, "  Swig::director_method_ids[i] = jenv->GetStaticMethodID(jcls, methods[i].method, methods[i].signature);\n");
-      Printf(w->code, "  if (!Swig::director_method_ids[i]) return;\n");
-      Printf(w->code, "}\n");
+      if (n_methods) {
+	Printf(w->code, "{\n");
+	Printf(w->code, "static struct {\n");
+	Printf(w->code, "  const char *method;\n");
+	Printf(w->code, "  const char *signature;\n");
+	Printf(w->code, "} methods[%d] = {\n", n_methods);
+	Printv(w->code, dmethod_data, NIL);
+	Printf(w->code, "};\n");
+
+	Printf(w->code, "Swig::jclass_%s = (jclass) jenv->NewGlobalRef(jcls);\n", imclass_name);
+	Printf(w->code, "if (!Swig::jclass_%s) return;\n", imclass_name);
+	Printf(w->code, "for (i = 0; i < (int) (sizeof(methods)/sizeof(methods[0])); ++i) {\n");
+	Printf(w->code, "  Swig::director_method_ids[i] = jenv->GetStaticMethodID(jcls, methods[i].method, methods[i].signature);\n");
+	Printf(w->code, "  if (!Swig::director_method_ids[i]) return;\n");
+	Printf(w->code, "}\n");
+	Printf(w->code, "}\n");
+      } else {
+	Printf(w->code, "(void)jcls;\n");
+      }
+
+      // After the director method IDs, as this returns early if a class or member is missing
+      if (hasJavaRefs())
+	emitJavaRefsLookup(w);
 
       Printf(w->code, "}\n");
 
@@ -3717,6 +4145,62 @@ public:
     }
   }
 
+  /*----------------------------------------------------------------------
+   * emitConstantsInitCopy()
+   *
+   * Emit the copy of the values of the constants before end, which have not
+   * been copied yet, to the Java array returned by swig_constants_init.
+   *--------------------------------------------------------------------*/
+
+  void emitConstantsInitCopy(String *code, int end) {
+    // Equivalent of the JCALL macros, which are only expanded by the SWIG preprocessor
+    const char *jcall = CPlusPlus ? "jenv->" : "(*jenv)->";
+    const char *jenvarg = CPlusPlus ? "" : "jenv, ";
+    int start = (end - 1) / ConstantsInitChunk * ConstantsInitChunk;
+    Printf(code, "%sSetLongArrayRegion(%sjresult, %d, %d, values);\n", jcall, jenvarg, start, end - start);
+  }
+
+  /*----------------------------------------------------------------------
+   * emitConstantsInit()
+   *
+   * Emit swig_constants_init, which returns the values of the constants
+   * added by constantsInitValue() in a long array. The values are copied to
+   * the array a chunk at a time to keep the buffer on the stack small.
+   *--------------------------------------------------------------------*/
+
+  void emitConstantsInit() {
+    if (n_constants_init) {
+      Wrapper *w = NewWrapper();
+      String *jni_imclass_name = makeValidJniName(imclass_name);
+      String *swig_constants_init = NewString("swig_constants_init");
+      String *swig_constants_init_jni = makeValidJniName(swig_constants_init);
+      String *values = NewStringf("values[%d]", n_constants_init < ConstantsInitChunk ? n_constants_init : (int)ConstantsInitChunk);
+
+      // Equivalent of the JCALL macros, which are only expanded by the SWIG preprocessor
+      const char *jcall = CPlusPlus ? "jenv->" : "(*jenv)->";
+      const char *jenvarg = CPlusPlus ? "" : "jenv, ";
+
+      Printf(w->def, "SWIGEXPORT jlongArray JNICALL Java_%s%s_%s(JNIEnv *jenv, jclass jcls) {", jnipackage, jni_imclass_name, swig_constants_init_jni);
+      Wrapper_add_localv(w, "jresult", "jlongArray", "jresult = 0", NIL);
+      Wrapper_add_localv(w, "values", "jlong", values, NIL);
+      Printf(w->code, "(void)jcls;\n");
+      Printf(w->code, "jresult = %sNewLongArray(%s%d);\n", jcall, jenvarg, n_constants_init);
+      Printf(w->code, "if (!jresult) return 0;\n");
+      Printv(w->code, constants_init_code, NIL);
+      if (n_constants_init % ConstantsInitChunk)
+	emitConstantsInitCopy(w->code, n_constants_init);
+      Printf(w->code, "return jresult;\n");
+      Printf(w->code, "}\n");
+
+      Wrapper_print(w, f_wrappers);
+      Delete(values);
+      Delete(swig_constants_init_jni);
+      Delete(swig_constants_init);
+      Delete(jni_imclass_name);
+      DelWrapper(w);
+    }
+  }
+
   /*----------------------------------------------------------------------
    * emitDirectorExtraMethods()
    *
@@ -16,6 +16,7 @@
 
 static const char *usage = (char *) "\
 Matlab Options (available with -matlab)\n\
+     -dispatchcache  - Cache the overload selected for each argument signature in dispatch functions\n\
      -opprefix <str> - Set global operator functions prefix to <str> [default: 'op_']\n\
      -pkgname <str>  - Set package name prefix to <str> [default: '<module>']\n\
      -mexname <name> - Set mex function name to <name> [default: '<module>MEX']\n\
@@ -101,6 +102,7 @@ protected:
   String *pkg_name;
   String *pkg_name_fullpath;
   bool redirectoutput;
+  bool dispatchcache;
   int no_header_file;
 
   // Helper functions
@@ -181,6 +183,7 @@ MATLAB::MATLAB():
 void MATLAB::main(int argc, char *argv[]) {
   int cppcast = 1;
   redirectoutput = false;
+  dispatchcache = false;
 
   for (int i = 1; i < argc; i++) {
     if (argv[i]) {
@@ -225,6 +228,9 @@ void MATLAB::main(int argc, char *argv[]) {
       } else if (strcmp(argv[i], "-redirectoutput") == 0) {
 	redirectoutput = true;
 	Swig_mark_arg(i);
+      } else if (strcmp(argv[i], "-dispatchcache") == 0) {
+	dispatchcache = true;
+	Swig_mark_arg(i);
       }
     }
   }
@@ -2312,8 +2318,9 @@ void MATLAB::finalizeGateway() {
   Printf(f_gateway, "  default: flag=1, SWIG_Error(SWIG_RuntimeError, \"No function id %%d.\", fcn_id);\n");
   Printf(f_gateway, "  }\n");
 
-  // Restore std::cout and std::cerr
+  // Flush buffered output, restore std::cout and std::cerr
   if (CPlusPlus && redirectoutput) {
+    Printf(f_gateway, "  swig::SWIG_Matlab_buf.pubsync();\n");
     Printf(f_gateway, "  std::cout.rdbuf(cout_backup);\n");
     Printf(f_gateway, "  std::cerr.rdbuf(cerr_backup);\n");
   }
@@ -2447,7 +2454,7 @@ void MATLAB::wrapConstructorDirector(int gw_ind, String *symname, String *fullna
     // Printf(f_wrap_m,"        self.swigPtr = %s(%d, varargin{:});\n", mex_name, gw_ind);
     if (have_matlabprepend(n))
       Printf(f_wrap_m, "%s\n", matlabprepend(n));
-    Printf(f_wrap_m, "        if strcmp(class(self),'director_basic.%s')\n", symname);
+    Printf(f_wrap_m, "        if strcmp(class(self),'%s.%s')\n", pkg_name, symname);
     Printf(f_wrap_m, "          tmp = %s(%d, 0, varargin{:});\n", mex_name, gw_ind);
     Printf(f_wrap_m, "        else\n");
     Printf(f_wrap_m, "          tmp = %s(%d, self, varargin{:});\n", mex_name, gw_ind);
@@ -2915,7 +2922,11 @@ void MATLAB::dispatchFunction(Node *n) {
   String *iname = Getattr(n, "sym:name");
   String *wname = Swig_name_wrapper(iname);
   int maxargs;
-  String *dispatch = Swig_overload_dispatch(n, "return %s(resc,resv,argc,argv);", &maxargs);
+  // Cache the selected overload per argument signature (see SWIG_Matlab_DispatchKey)
+  bool cache = dispatchcache || GetFlag(n, "feature:matlab:dispatchcache");
+  String *dispatch = cache ?
+    Swig_overload_dispatch(n, "return SWIG_Matlab_DispatchCall(cacheable ? &cache : 0, &key, %s, resc,resv,argc,argv);", &maxargs) :
+    Swig_overload_dispatch(n, "return %s(resc,resv,argc,argv);", &maxargs);
   String *tmp = NewString("");
 
   Node *sibl = n;
@@ -2929,6 +2940,13 @@ void MATLAB::dispatchFunction(Node *n) {
   } while ((sibl = Getattr(sibl, "sym:nextSibling")));
 
   Printf(f->def, "int %s(int resc, mxArray *resv[], int argc, mxArray *argv[]) {", wname);
+  if (cache) {
+    Wrapper_add_local(f, "cache", "static SwigDispatchCache cache");
+    Wrapper_add_local(f, "key", "SwigDispatchKey key");
+    Wrapper_add_local(f, "fcn", "SwigDispatchFcn fcn");
+    Printf(f->code, "int cacheable = SWIG_Matlab_DispatchKey(&key, argc, argv);\n");
+    Printf(f->code, "if (cacheable && (fcn = SWIG_Matlab_DispatchLookup(&cache, &key))) return fcn(resc,resv,argc,argv);\n");
+  }
   Printv(f->code, dispatch, "\n", NIL);
   Printf(f->code, "SWIG_Error(SWIG_RuntimeError, \"No matching function for overload function '%s'.\"\n", iname);
   Printf(f->code, "   \"  Possible C/C++ prototypes are:\\n\"%s);\n", protoTypes);
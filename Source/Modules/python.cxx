@@ -75,6 +75,7 @@ static String *real_classname;
 /* Thread Support */
 static int threads = 0;
 static int nothreads = 0;
+static int cheapthreads = 0;
 static int classptr = 0;
 /* Other options */
 static int shadowimport = 1;
@@ -82,11 +83,14 @@ static int buildnone = 0;
 static int nobuildnone = 0;
 static int safecstrings = 0;
 static int dirvtable = 0;
+static int dispatchcache = 0;
 static int proxydel = 1;
 static int fastunpack = 0;
+static int fastcall = 0;
 static int fastproxy = 0;
 static int fastquery = 0;
 static int fastinit = 0;
+static int fastthis = 0;
 static int olddefs = 0;
 static int modernargs = 0;
 static int aliasobj0 = 0;
@@ -113,15 +117,19 @@ Python Options (available with -python)\n\
      -buildnone      - Use Py_BuildValue(" ") to obtain Py_None (default in Windows)\n\
      -builtin        - Create new python built-in types, rather than proxy classes, for better performance\n\
      -castmode       - Enable the casting mode, which allows implicit cast between types in python\n\
+     -cheapthreads   - Keep the GIL in member variable accessors and inline functions with -threads \n\
      -classic        - Use classic classes only\n\
      -classptr       - Generate shadow 'ClassPtr' as in older swig versions\n\
      -cppcast        - Enable C++ casting operators (default) \n\
      -dirvtable      - Generate a pseudo virtual table for directors for faster dispatch \n\
+     -dispatchcache  - Cache the overload selected for each argument signature in dispatch functions \n\
      -extranative    - Return extra native C++ wraps for std containers when possible \n\
+     -fastcall       - Use the METH_FASTCALL calling convention, implies -fastunpack (Python 3.7 or later)\n\
      -fastinit       - Use fast init mechanism for classes (default)\n\
      -fastunpack     - Use fast unpack mechanism to parse the argument functions \n\
      -fastproxy      - Use fast proxy mechanism for member methods \n\
      -fastquery      - Use fast query mechanism for types \n\
+     -fastthis       - Keep 'this' in a slot of a common base of the proxy classes for faster lookup \n\
      -globals <name> - Set <name> used to access C global variable [default: 'cvar']\n\
      -interface <lib>- Set the lib name to <lib>\n\
      -keyword        - Use keyword arguments\n\
@@ -133,14 +141,18 @@ static const char *usage2 = "\
      -noaliasobj0    - Don't generate an obj0 alias when using fastunpack (default) \n\
      -nobuildnone    - Access Py_None directly (default in non-Windows systems)\n\
      -nocastmode     - Disable the casting mode (default)\n\
+     -nocheapthreads - Release the GIL in all the wrappers with -threads (default) \n\
      -nocppcast      - Disable C++ casting operators, useful for generating bugs\n\
      -nodirvtable    - Don't use the virtual table feature, resolve the python method each time (default)\n\
+     -nodispatchcache - Run all the typechecks of overloaded functions on every call (default) \n\
      -noexcept       - No automatic exception handling\n\
      -noextranative  - Don't use extra native C++ wraps for std containers when possible (default) \n\
+     -nofastcall     - Pass the arguments to the wrappers in a tuple (default) \n\
      -nofastinit     - Use traditional init mechanism for classes \n\
      -nofastunpack   - Use traditional UnpackTuple method to parse the argument functions (default) \n\
      -nofastproxy    - Use traditional proxy mechanism for member methods (default) \n\
      -nofastquery    - Use traditional query mechanism for types (default) \n\
+     -nofastthis     - Keep 'this' in the instance dictionary of proxy classes (default) \n\
      -noh            - Don't generate the output header file\n\
      -nomodern       - Don't use modern python features which are not backwards compatible \n\
      -nomodernargs   - Use classic ParseTuple/CallFunction methods to pack/unpack the function arguments (default) \n";
@@ -260,6 +272,20 @@ public:
     return threads && !GetFlagAttr(n, "feature:nothread");
   }
 
+  /* Whether a wrapper is too cheap to be worth releasing the GIL: functions
+   * marked with %feature("nothreadallow_cheap") and, with -cheapthreads,
+   * variable accessors and functions defined in the interface (inline
+   * functions, %inline and %extend). %feature("nothreadallow_cheap", "0")
+   * releases the GIL anyway. */
+  bool threads_cheap(Node *n) const {
+    String *cheap = Getattr(n, "feature:nothreadallow_cheap");
+    if (cheap)
+      return Strcmp(cheap, "0") != 0;
+    if (!cheapthreads)
+      return false;
+    return GetFlag(n, "memberget") || GetFlag(n, "memberset") || GetFlag(n, "varget") || GetFlag(n, "varset") || Getattr(n, "code");
+  }
+
   int initialize_threads(String *f_init) {
     if (!threads) {
       return SWIG_OK;
@@ -293,12 +319,20 @@ public:
     }
   }
 
+  /* The GIL releases are only counted when both halves are the default ones, as the
+     _STAT macros declare and use the same local variables */
+  bool thread_allow_stat(Node *n) {
+    return !Getattr(n, "feature:threadbeginallow") && !Getattr(n, "feature:threadendallow");
+  }
+
   virtual void thread_begin_allow(Node *n, String *f) {
     if (!GetFlag(n, "feature:nothreadallow")) {
       String *bb = Getattr(n, "feature:threadbeginallow");
       Append(f, "{\n");
       if (bb) {
 	Append(f, bb);
+      } else if (thread_allow_stat(n)) {
+	Printf(f, "SWIG_PYTHON_THREAD_BEGIN_ALLOW_STAT(\"%s\");\n", Getattr(n, "sym:name"));
       } else {
 	Append(f, "SWIG_PYTHON_THREAD_BEGIN_ALLOW;\n");
       }
@@ -311,6 +345,8 @@ public:
       Append(f, "\n");
       if (eb) {
 	Append(f, eb);
+      } else if (thread_allow_stat(n)) {
+	Append(f, "SWIG_PYTHON_THREAD_END_ALLOW_STAT;");
       } else {
 	Append(f, "SWIG_PYTHON_THREAD_END_ALLOW;");
       }
@@ -394,6 +430,12 @@ public:
 	} else if (strcmp(argv[i], "-threads") == 0) {
 	  threads = 1;
 	  Swig_mark_arg(i);
+	} else if (strcmp(argv[i], "-cheapthreads") == 0) {
+	  cheapthreads = 1;
+	  Swig_mark_arg(i);
+	} else if (strcmp(argv[i], "-nocheapthreads") == 0) {
+	  cheapthreads = 0;
+	  Swig_mark_arg(i);
 	} else if (strcmp(argv[i], "-nothreads") == 0) {
 	  /* Turn off thread suppor mode */
 	  nothreads = 1;
@@ -418,12 +460,26 @@ public:
 	} else if (strcmp(argv[i], "-nodirvtable") == 0) {
 	  dirvtable = 0;
 	  Swig_mark_arg(i);
+	} else if (strcmp(argv[i], "-dispatchcache") == 0) {
+	  dispatchcache = 1;
+	  Swig_mark_arg(i);
+	} else if (strcmp(argv[i], "-nodispatchcache") == 0) {
+	  dispatchcache = 0;
+	  Swig_mark_arg(i);
 	} else if (strcmp(argv[i], "-fastunpack") == 0) {
 	  fastunpack = 1;
 	  Swig_mark_arg(i);
 	} else if (strcmp(argv[i], "-nofastunpack") == 0) {
 	  fastunpack = 0;
 	  Swig_mark_arg(i);
+	} else if (strcmp(argv[i], "-fastcall") == 0) {
+	  fastcall = 1;
+	  fastunpack = 1;
+	  modernargs = 1;
+	  Swig_mark_arg(i);
+	} else if (strcmp(argv[i], "-nofastcall") == 0) {
+	  fastcall = 0;
+	  Swig_mark_arg(i);
 	} else if (strcmp(argv[i], "-fastproxy") == 0) {
 	  fastproxy = 1;
 	  Swig_mark_arg(i);
@@ -442,6 +498,12 @@ public:
 	} else if (strcmp(argv[i], "-nofastinit") == 0) {
 	  fastinit = 0;
 	  Swig_mark_arg(i);
+	} else if (strcmp(argv[i], "-fastthis") == 0) {
+	  fastthis = 1;
+	  Swig_mark_arg(i);
+	} else if (strcmp(argv[i], "-nofastthis") == 0) {
+	  fastthis = 0;
+	  Swig_mark_arg(i);
 	} else if (strcmp(argv[i], "-olddefs") == 0) {
 	  olddefs = 1;
 	  Swig_mark_arg(i);
@@ -536,6 +598,11 @@ public:
       classic = 0;
     }
 
+    if (builtin || classic) {
+      /* built-in types hold 'this' themselves, classic classes can't have a base type */
+      fastthis = 0;
+    }
+
     if (cppcast) {
       Preprocessor_define((DOH *) "SWIG_CPLUSPLUS_CAST", 0);
     }
@@ -715,6 +782,10 @@ public:
       Printf(f_runtime, "#define SWIGPYTHON_BUILTIN\n");
     }
 
+    if (fastthis) {
+      Printf(f_runtime, "#define SWIGPYTHON_FASTTHIS\n");
+    }
+
     Printf(f_runtime, "\n");
 
     Printf(f_header, "#if (PY_VERSION_HEX <= 0x02000000)\n");
@@ -741,6 +812,12 @@ public:
       Printf(f_header, "#endif\n");
     }
 
+    if (fastcall) {
+      Printf(f_header, "#if (PY_VERSION_HEX < 0x03070000)\n");
+      Printf(f_header, "# error \"This python version requires swig to be run without the '-fastcall' option\"\n");
+      Printf(f_header, "#endif\n");
+    }
+
     if (fastquery) {
       Printf(f_header, "#ifdef SWIG_TypeQuery\n");
       Printf(f_header, "# undef SWIG_TypeQuery\n");
@@ -917,7 +994,8 @@ public:
 	Printv(f_shadow,
 	       "\n", "def _swig_setattr_nondynamic(self, class_type, name, value, static=1):\n",
 	       tab4, "if (name == \"thisown\"):\n", tab8, "return self.this.own(value)\n",
-	       tab4, "if (name == \"this\"):\n", tab8, "if type(value).__name__ == 'SwigPyObject':\n", tab4, tab8, "self.__dict__[name] = value\n",
+	       tab4, "if (name == \"this\"):\n", tab8, "if type(value).__name__ == 'SwigPyObject':\n", tab4, tab8,
+	       fastthis ? "object.__setattr__(self, name, value)\n" : "self.__dict__[name] = value\n",
 #ifdef USE_THISOWN
 	       tab4, tab8, "if hasattr(value,\"thisown\"):\n", tab8, tab8, "self.__dict__[\"thisown\"] = value.thisown\n", tab4, tab8, "del value.thisown\n",
 #endif
@@ -961,6 +1039,12 @@ public:
 		 "except __builtin__.Exception:\n",
 		 tab4, "class _object:\n", tab8, "pass\n", tab4, "_newclass = 0\n\n", NIL);
 	}
+	if (fastthis) {
+	  Printf(f_shadow, "_object = %s.SwigPyThis\n\n", module);
+	}
+	if (threads && !nothreads && !builtin) {
+	  Printf(f_shadow, "SWIG_PyThreadStats = %s.SWIG_PyThreadStats\n\n", module);
+	}
       }
       if (modern) {
 	Printv(f_shadow,  "\n", "def _swig_setattr_nondynamic_method(set):\n", tab4, "def set_attr(self, name, value):\n",
@@ -1000,6 +1084,11 @@ public:
     /* the method exported for replacement of new.instancemethod in Python 3 */
     add_pyinstancemethod_new();
 
+    /* the GIL release statistics */
+    if (threads && !nothreads) {
+      Printf(methods, "\t { (char *)\"SWIG_PyThreadStats\", (PyCFunction)SWIG_Python_ThreadStats, METH_VARARGS, NULL},\n");
+    }
+
     if (builtin) {
       SwigType *s = NewString("SwigPyObject");
       SwigType_add_pointer(s);
@@ -2457,8 +2546,10 @@ public:
    * add_method()
    * ------------------------------------------------------------ */
 
-  void add_method(String *name, String *function, int kw, Node *n = 0, int funpack= 0, int num_required= -1, int num_arguments = -1) {
-    if (!kw) {
+  void add_method(String *name, String *function, int kw, Node *n = 0, int funpack= 0, int num_required= -1, int num_arguments = -1, bool use_fastcall = false) {
+    if (use_fastcall) {
+      Printf(methods, "\t { (char *)\"%s\", (PyCFunction) %s, METH_FASTCALL%s, ", name, function, kw ? " | METH_KEYWORDS" : "");
+    } else if (!kw) {
       if (n && funpack) {
 	if (num_required == 0 && num_arguments == 0) {
 	  Printf(methods, "\t { (char *)\"%s\", (PyCFunction)%s, METH_NOARGS, ", name, function);
@@ -2492,7 +2583,7 @@ public:
   /* ------------------------------------------------------------
    * dispatchFunction()
    * ------------------------------------------------------------ */
-  void dispatchFunction(Node *n, String *linkage, int funpack = 0, bool builtin_self = false, bool builtin_ctor = false, bool director_class = false) {
+  void dispatchFunction(Node *n, String *linkage, int funpack = 0, bool builtin_self = false, bool builtin_ctor = false, bool director_class = false, bool use_fastcall = false) {
     /* Last node in overloaded chain */
 
     bool add_self = builtin_self && (!builtin_ctor || director_class);
@@ -2503,6 +2594,19 @@ public:
     String *dispatch;
     const char *dispatch_code = funpack ? "return %s(self, argc, argv);" : "return %s(self, args);";
 
+    /* Cache the selected overload per argument signature (see SWIG_Python_DispatchKey),
+       unless a typecheck may convert its argument implicitly */
+    bool cache = !castmode && (dispatchcache || GetFlag(n, "feature:python:dispatchcache"));
+    for (Node *sibl = n; cache && sibl; sibl = Getattr(sibl, "sym:previousSibling")) {
+      for (Parm *p = Getattr(sibl, "wrap:parms"); p && cache; p = nextSibling(p)) {
+	String *conv = Getattr(p, "implicitconv");
+	if (conv && Strcmp(conv, "0") != 0)
+	  cache = false;
+      }
+    }
+    if (cache)
+      dispatch_code = "fcn = (SwigPyDispatchFcn)%s; goto dispatch_found;";
+
     if (castmode) {
       dispatch = Swig_overload_dispatch_cast(n, dispatch_code, &maxargs);
     } else {
@@ -2515,7 +2619,10 @@ public:
     String *symname = Getattr(n, "sym:name");
     String *wname = Swig_name_wrapper(symname);
 
-    Printv(f->def, linkage, builtin_ctor ? "int " : "PyObject *", wname, "(PyObject *self, PyObject *args) {", NIL);
+    if (use_fastcall)
+      Printv(f->def, linkage, "PyObject *", wname, "(PyObject *self, PyObject *const *args, Py_ssize_t nargs) {", NIL);
+    else
+      Printv(f->def, linkage, builtin_ctor ? "int " : "PyObject *", wname, "(PyObject *self, PyObject *args) {", NIL);
 
     Wrapper_add_local(f, "argc", "Py_ssize_t argc");
     Printf(tmp, "PyObject *argv[%d] = {0}", maxargs + 1);
@@ -2535,7 +2642,10 @@ public:
 	Append(f->code, "argc++;\n");
     } else {
       String *iname = Getattr(n, "sym:name");
-      Printf(f->code, "if (!(argc = SWIG_Python_UnpackTuple(args,\"%s\",0,%d,argv%s))) SWIG_fail;\n", iname, maxargs, add_self ? "+1" : "");
+      if (use_fastcall)
+	Printf(f->code, "if (!(argc = SWIG_Python_UnpackFastcall(args,nargs,\"%s\",0,%d,argv%s))) SWIG_fail;\n", iname, maxargs, add_self ? "+1" : "");
+      else
+	Printf(f->code, "if (!(argc = SWIG_Python_UnpackTuple(args,\"%s\",0,%d,argv%s))) SWIG_fail;\n", iname, maxargs, add_self ? "+1" : "");
       if (add_self)
 	Append(f->code, "argv[0] = self;\n");
       else
@@ -2544,8 +2654,29 @@ public:
 
     Replaceall(dispatch, "$args", "self, args");
 
+    if (cache) {
+      Wrapper_add_local(f, "cache", "static SwigPyDispatchCache cache");
+      Wrapper_add_local(f, "key", "SwigPyDispatchKey key");
+      Wrapper_add_local(f, "fcn", "SwigPyDispatchFcn fcn = 0");
+      Wrapper_add_local(f, "cacheable", "int cacheable");
+      Printf(f->code, "cacheable = (argc <= %d) && SWIG_Python_DispatchKey(&key, argc, argv);\n", maxargs);
+      Append(f->code, "if (cacheable && (fcn = SWIG_Python_DispatchLookup(&cache, &key))) goto dispatch_call;\n");
+    }
+
     Printv(f->code, dispatch, "\n", NIL);
 
+    if (cache) {
+      const char *fcn_type = builtin_ctor ? "int" : "PyObject *";
+      Append(f->code, "goto fail;\n");
+      Append(f->code, "dispatch_found:\n");
+      Append(f->code, "if (cacheable) SWIG_Python_DispatchStore(&cache, &key, fcn);\n");
+      Append(f->code, "dispatch_call:\n");
+      if (funpack)
+	Printf(f->code, "return ((%s (*)(PyObject *, int, PyObject **))fcn)(self, (int)argc, argv);\n", fcn_type);
+      else
+	Printf(f->code, "return ((%s (*)(PyObject *, PyObject *))fcn)(self, args);\n", fcn_type);
+    }
+
     if (GetFlag(n, "feature:python:maybecall")) {
       Append(f->code, "fail:\n");
       Append(f->code, "Py_INCREF(Py_NotImplemented);\n");
@@ -2570,7 +2701,7 @@ public:
     Wrapper_print(f, f_wrappers);
     Node *p = Getattr(n, "sym:previousSibling");
     if (!builtin_self)
-      add_method(symname, wname, 0, p);
+      add_method(symname, wname, 0, p, 0, -1, -1, use_fastcall);
 
     /* Create a shadow for this function (if enabled and not in a member function) */
     if (!builtin && (shadow) && (!(shadow & PYSHADOW_MEMBER))) {
@@ -2767,11 +2898,23 @@ public:
 	over_varargs = true;
     }
 
-    int funpack = modernargs && fastunpack && !varargs && !over_varargs && !allow_kwargs;
-    int noargs = funpack && (tuple_required == 0 && tuple_arguments == 0);
-    int onearg = funpack && (tuple_required == 1 && tuple_arguments == 1);
+    /* Wrappers (or dispatch functions of overloaded wrappers) can take their
+       arguments as a C array unless they are called through a slot, as tp_init
+       or as a getter or setter, all of which pass a tuple */
+    bool use_fastcall = fastcall && modernargs && fastunpack && !varargs && !over_varargs && !builtin_ctor && !builtin_getter && !builtin_setter
+	&& !(builtin && in_class && (Getattr(n, "feature:python:slot") || Getattr(n, "feature:python:compare")));
+    for (p = l; p && use_fastcall; p = nextSibling(p)) {
+      if (Getattr(p, "tmap:in:parse"))
+	use_fastcall = false;
+    }
+    int funpack = modernargs && fastunpack && !varargs && !over_varargs && (!allow_kwargs || use_fastcall);
+    int noargs = funpack && !allow_kwargs && (tuple_required == 0 && tuple_arguments == 0);
+    int onearg = funpack && !allow_kwargs && (tuple_required == 1 && tuple_arguments == 1);
+    /* METH_NOARGS and METH_O are cheaper still */
+    if (!overname && (noargs || onearg))
+      use_fastcall = false;
 
-    if (builtin && funpack && !overname && !builtin_ctor && 
+    if (builtin && funpack && !overname && !builtin_ctor && !allow_kwargs &&
       !(GetFlag(n, "feature:compactdefaultargs") && (tuple_arguments > tuple_required || varargs))) {
       String *argattr = NewStringf("%d", tuple_arguments);
       Setattr(n, "python:argcount", argattr);
@@ -2912,10 +3055,11 @@ public:
 
     if (builtin && !funpack && in_class && tuple_arguments == 0) {
       Printf(parse_args, "    if (args && PyTuple_Check(args) && PyTuple_GET_SIZE(args) > 0) SWIG_exception_fail(SWIG_TypeError, \"%s takes no arguments\");\n", iname);
-    } else if (use_parse || allow_kwargs || !modernargs) {
+    } else if (use_parse || (allow_kwargs && !funpack) || !modernargs) {
       Printf(parse_args, ":%s\"", iname);
       Printv(parse_args, arglist, ")) SWIG_fail;\n", NIL);
       funpack = 0;
+      use_fastcall = false;
     } else {
       Clear(parse_args);
       if (funpack) {
@@ -2927,6 +3071,14 @@ public:
 	    Printv(f->def, linkage, wrap_return, wname, "(PyObject *", self_param, ", int nobjs, PyObject **swig_obj) {", NIL);
 	  }
 	  Printf(parse_args, "if ((nobjs < %d) || (nobjs > %d)) SWIG_fail;\n", num_required, num_arguments);
+	} else if (use_fastcall) {
+	  if (allow_kwargs) {
+	    Printv(f->def, linkage, wrap_return, wname, "(PyObject *", self_param, ", PyObject *const *args, Py_ssize_t nargs, PyObject *kwargs) {", NIL);
+	    Printf(parse_args, "if (!SWIG_Python_UnpackFastcallKeywords(args,nargs,kwargs,\"%s\",%d,%d,kwnames,swig_obj)) SWIG_fail;\n", iname, num_fixed_arguments, tuple_arguments);
+	  } else {
+	    Printv(f->def, linkage, wrap_return, wname, "(PyObject *", self_param, ", PyObject *const *args, Py_ssize_t nargs) {", NIL);
+	    Printf(parse_args, "if (!SWIG_Python_UnpackFastcall(args,nargs,\"%s\",%d,%d,swig_obj)) SWIG_fail;\n", iname, num_fixed_arguments, tuple_arguments);
+	  }
 	} else {
 	  if (noargs) {
 	    Printv(f->def, linkage, wrap_return, wname, "(PyObject *", self_param, ", PyObject *args) {", NIL);
@@ -3051,7 +3203,7 @@ public:
     if (director_method) {
       Append(f->code, "try {\n");
     } else {
-      if (allow_thread) {
+      if (allow_thread && !threads_cheap(n)) {
 	String *preaction = NewString("");
 	thread_begin_allow(n, preaction);
 	Setattr(n, "wrap:preaction", preaction);
@@ -3260,7 +3412,7 @@ public:
     /* Now register the function with the interpreter.   */
     if (!Getattr(n, "sym:overloaded")) {
       if (!builtin_self)
-	add_method(iname, wname, allow_kwargs, n, funpack, num_required, num_arguments);
+	add_method(iname, wname, allow_kwargs, n, funpack, num_required, num_arguments, use_fastcall);
 
       /* Create a shadow for this function (if enabled and not in a member function) */
       if (!builtin && (shadow) && (!(shadow & PYSHADOW_MEMBER))) {
@@ -3268,7 +3420,7 @@ public:
       }
     } else {
       if (!Getattr(n, "sym:nextSibling")) {
-	dispatchFunction(n, linkage, funpack, builtin_self, builtin_ctor, director_class);
+	dispatchFunction(n, linkage, funpack, builtin_self, builtin_ctor, director_class, use_fastcall);
       }
     }
 
@@ -3281,6 +3433,9 @@ public:
       }
     }
 
+    if (builtin && in_class && use_fastcall)
+      SetFlag(n, "python:fastcall");
+
     /* If this is a builtin type, create a PyGetSetDef entry for this member variable. */
     if (builtin) {
       const char *memname = "__dict__";
@@ -4423,7 +4578,7 @@ public:
 	  Printf(f_shadow, "(%s)", base_class);
 	} else {
 	  if (!classic) {
-	    Printf(f_shadow, modern ? "(object)" : "(_object)");
+	    Printf(f_shadow, (modern && !fastthis) ? "(object)" : "(_object)");
 	  }
 	  if (GetFlag(n, "feature:exceptionclass")) {
 	    Printf(f_shadow, "(Exception)");
@@ -4639,7 +4794,7 @@ public:
     int oldshadow;
 
     if (builtin)
-      Swig_save("builtin_memberfunc", n, "python:argcount", NIL);
+      Swig_save("builtin_memberfunc", n, "python:argcount", "python:fastcall", NIL);
 
     /* Create the default member function */
     oldshadow = shadow;		/* Disable shadowing when wrapping member functions */
@@ -4657,7 +4812,10 @@ public:
 	Setattr(class_members, symname, n);
 	int argcount = Getattr(n, "python:argcount") ? atoi(Char(Getattr(n, "python:argcount"))) : 2;
 	String *ds = have_docstring(n) ? cdocstring(n, AUTODOC_FUNC) : NewString("");
-	if (check_kwargs(n)) {
+	if (GetFlag(n, "python:fastcall")) {
+	  int kw = (check_kwargs(n) && !Getattr(n, "sym:overloaded")) ? 1 : 0;
+	  Printf(builtin_methods, "  { \"%s\", (PyCFunction) %s, METH_FASTCALL%s, (char*) \"%s\" },\n", symname, wname, kw ? "|METH_KEYWORDS" : "", ds);
+	} else if (check_kwargs(n)) {
 	  Printf(builtin_methods, "  { \"%s\", (PyCFunction) %s, METH_VARARGS|METH_KEYWORDS, (char*) \"%s\" },\n", symname, wname, ds);
 	} else if (argcount == 0) {
 	  Printf(builtin_methods, "  { \"%s\", (PyCFunction) %s, METH_NOARGS, (char*) \"%s\" },\n", symname, wname, ds);
@@ -4757,7 +4915,9 @@ public:
 	int funpack = modernargs && fastunpack && !Getattr(n, "sym:overloaded");
 	String *pyflags = NewString("METH_STATIC|");
 	int argcount = Getattr(n, "python:argcount") ? atoi(Char(Getattr(n, "python:argcount"))) : 2;
-	if (funpack && argcount == 0)
+	if (GetFlag(n, "python:fastcall"))
+	  Append(pyflags, (check_kwargs(n) && !Getattr(n, "sym:overloaded")) ? "METH_FASTCALL|METH_KEYWORDS" : "METH_FASTCALL");
+	else if (funpack && argcount == 0)
 	  Append(pyflags, "METH_NOARGS");
 	else if (funpack && argcount == 1)
 	  Append(pyflags, "METH_O");
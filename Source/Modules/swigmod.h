@@ -415,6 +415,10 @@ void Wrapper_naturalvar_mode_set(int);
 
 void clean_overloaded(Node *n);
 
+String *fold_constant_value(String *expr, SwigType *type, Hash *values, int *overflow = 0);
+int fold_constant_overflow(Node *n);
+String *fold_enum_value(Node *n);
+
 extern "C" {
   const char *Swig_to_string(DOH *object, int count = -1);
   const char *Swig_to_string_with_location(DOH *object, int count = -1);
@@ -12,6 +12,7 @@
  * ----------------------------------------------------------------------------- */
 
 #include <swigmod.h>
+#include <limits.h>
 
 int is_public(Node *n) {
   String *access = Getattr(n, "access");
@@ -104,6 +105,120 @@ void clean_overloaded(Node *n) {
   }
 }
 
+/* -----------------------------------------------------------------------------
+ * fold_constant_value()
+ *
+ * Evaluates the C expression of an integral constant of the given type with
+ * Preprocessor_expr_constant(), looking up identifiers in values, which may be
+ * NULL. Returns the value as a decimal string, or NULL if the expression cannot
+ * be evaluated or the value does not fit the type on all platforms. In the
+ * latter case, or if the evaluation overflows, overflow is set if given.
+ * ----------------------------------------------------------------------------- */
+
+String *fold_constant_value(String *expr, SwigType *type, Hash *values, int *overflow) {
+  long minimum = -2147483647L - 1;
+  long maximum = 2147483647L;
+  switch (SwigType_type(type)) {
+  case T_SCHAR:
+    minimum = -128;
+    maximum = 127;
+    break;
+  case T_UCHAR:
+    minimum = 0;
+    maximum = 255;
+    break;
+  case T_SHORT:
+    minimum = -32768;
+    maximum = 32767;
+    break;
+  case T_USHORT:
+    minimum = 0;
+    maximum = 65535;
+    break;
+  case T_INT:
+  case T_LONG:
+    break;
+  case T_UINT:
+  case T_ULONG:
+    minimum = 0;
+    maximum = (long)(0xFFFFFFFFUL <= (unsigned long)LONG_MAX ? 0xFFFFFFFFUL : LONG_MAX);
+    break;
+  case T_LONGLONG:
+    minimum = LONG_MIN;
+    maximum = LONG_MAX;
+    break;
+  default:
+    return 0;
+  }
+
+  String *s = NewString(expr);
+  int error = 0;
+  long value = Preprocessor_expr_constant(s, values, &error);
+  Delete(s);
+  if (overflow)
+    *overflow = (error == 2) || (!error && (value < minimum || value > maximum));
+  if (error || value < minimum || value > maximum)
+    return 0;
+  // Not NewStringf() as the DOH formatting does not support long
+  char buffer[32];
+  sprintf(buffer, "%ld", value);
+  return NewString(buffer);
+}
+
+/* -----------------------------------------------------------------------------
+ * fold_constant_overflow()
+ *
+ * Whether the value of the constant n overflows, see fold_constant_value(), in
+ * which case it is better obtained from the C/C++ compiler at runtime than by
+ * using its C expression in the target language.
+ * ----------------------------------------------------------------------------- */
+
+int fold_constant_overflow(Node *n) {
+  String *expr = Getattr(n, "wrappedasconstant") ? Getattr(n, "staticmembervariableHandler:value") : Getattr(n, "value");
+  int overflow = 0;
+  if (expr) {
+    String *value = fold_constant_value(expr, Getattr(n, "type"), 0, &overflow);
+    Delete(value);
+  }
+  return overflow;
+}
+
+/* -----------------------------------------------------------------------------
+ * fold_enum_value()
+ *
+ * Evaluates the value of an enum item with fold_constant_value(), either from
+ * its initializer, which may refer to the previous items of the same enum, or
+ * from the previous item's value. The values are recorded in the parent enum
+ * node for the following items. Returns NULL if the value cannot be evaluated.
+ * ----------------------------------------------------------------------------- */
+
+String *fold_enum_value(Node *n) {
+  Node *parent = parentNode(n);
+  Hash *values = Getattr(parent, "foldedvalues");
+  Hash *symvalues = Getattr(parent, "foldedsymvalues");
+  if (!values) {
+    values = NewHash();
+    symvalues = NewHash();
+    Setattr(parent, "foldedvalues", values);
+    Setattr(parent, "foldedsymvalues", symvalues);
+    Delete(values);
+    Delete(symvalues);
+  }
+
+  // The enumvalueex made up for items without an initializer refers to the previous item's symbol name
+  String *value = 0;
+  if (Getattr(n, "enumvalue"))
+    value = fold_constant_value(Getattr(n, "enumvalue"), Getattr(n, "type"), values);
+  else if (Getattr(n, "enumvalueex"))
+    value = fold_constant_value(Getattr(n, "enumvalueex"), Getattr(n, "type"), symvalues);
+
+  if (value) {
+    Setattr(values, Getattr(n, "name"), value);
+    Setattr(symvalues, Getattr(n, "sym:name"), value);
+  }
+  return value;
+}
+
 /* -----------------------------------------------------------------------------
  * Swig_set_max_hash_expand()
  *
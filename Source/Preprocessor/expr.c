@@ -14,6 +14,8 @@
 
 #include "swig.h"
 #include "preprocessor.h"
+#include <errno.h>
+#include <limits.h>
 
 static Scanner *scan = 0;
 
@@ -21,6 +23,7 @@ typedef struct {
   int op;
   long value;
   String *svalue;
+  int wide;			/* Of type long or wider, in constant mode */
 } exprval;
 
 #define  EXPR_TOP      1
@@ -35,6 +38,13 @@ static int prec[256];		/* Precedence rules    */
 static int expr_init = 0;	/* Initialization flag */
 static const char *errmsg = 0;	/* Parsing error       */
 
+/* Constant expression mode, see Preprocessor_expr_constant() */
+static int expr_constant = 0;	/* Evaluating a constant expression */
+static Hash *expr_values = 0;	/* Values of the identifiers        */
+static int expr_unsigned = 0;	/* An unsigned literal was used     */
+static int expr_negative = 0;	/* A negative value was computed    */
+static int expr_overflowed = 0;	/* The error is an integer overflow */
+
 /* Initialize the precedence table for various operators.  Low values have higher precedence */
 static void init_precedence() {
   prec[SWIG_TOKEN_NOT] = 10;
@@ -65,10 +75,52 @@ static void init_precedence() {
 			 ((token) == SWIG_TOKEN_LNOT) || \
 			 ((token) == EXPR_UMINUS))
 
+/* Whether a value fits a 32 bit unsigned int */
+static int expr_uint(long value) {
+  return (value >= 0) && ((unsigned long) value <= 4294967295UL);
+}
+
+/* -----------------------------------------------------------------------------
+ * expr_overflow()
+ *
+ * Checks whether applying the operator to the integers a and b, just a for the
+ * unary operators, overflows a long.  The division of LONG_MIN by -1 is always
+ * checked as it can trap, the other operators only in constant mode.
+ * ----------------------------------------------------------------------------- */
+
+static int expr_overflow(long op_token, long a, long b) {
+  int bits = (int) (sizeof(long) * CHAR_BIT);
+  if ((op_token == SWIG_TOKEN_SLASH) || (op_token == SWIG_TOKEN_PERCENT))
+    return (a == LONG_MIN) && (b == -1);
+  if (!expr_constant)
+    return 0;
+  switch (op_token) {
+  case SWIG_TOKEN_PLUS:
+    return (b > 0) ? (a > LONG_MAX - b) : (a < LONG_MIN - b);
+  case SWIG_TOKEN_MINUS:
+    return (b < 0) ? (a > LONG_MAX + b) : (a < LONG_MIN + b);
+  case SWIG_TOKEN_STAR:
+    if ((a == 0) || (b == 0))
+      return 0;
+    if (a > 0)
+      return (b > 0) ? (a > LONG_MAX / b) : (b < LONG_MIN / a);
+    return (b > 0) ? (a < LONG_MIN / b) : (b < LONG_MAX / a);
+  case SWIG_TOKEN_LSHIFT:
+    return (b < 0) || (b >= bits) || (a < 0) || (a > (LONG_MAX >> b));
+  case SWIG_TOKEN_RSHIFT:
+    return (b < 0) || (b >= bits);
+  case EXPR_UMINUS:
+    return a == LONG_MIN;
+  default:
+    return 0;
+  }
+}
+
 /* Reduce a single operator on the stack */
 /* return 0 on failure, 1 on success */
 static int reduce_op() {
   long op_token = stack[sp - 1].value;
+  int wide = 0;
   assert(sp > 0);
   assert(stack[sp - 1].op == EXPR_OP);
   /* do some basic checking first: */
@@ -118,6 +170,31 @@ static int reduce_op() {
       break;
     }
   } else {
+    if (UNARY_OP(op_token) ? expr_overflow(op_token, stack[sp].value, 0) : expr_overflow(op_token, stack[sp - 2].value, stack[sp].value)) {
+      errmsg = "Integer overflow";
+      expr_overflowed = 1;
+      return 0;
+    }
+    switch (op_token) {
+    case SWIG_TOKEN_EQUALTO:
+    case SWIG_TOKEN_NOTEQUAL:
+    case SWIG_TOKEN_LAND:
+    case SWIG_TOKEN_LOR:
+    case SWIG_TOKEN_LESSTHAN:
+    case SWIG_TOKEN_GREATERTHAN:
+    case SWIG_TOKEN_LTEQUAL:
+    case SWIG_TOKEN_GTEQUAL:
+    case SWIG_TOKEN_LNOT:
+      wide = 0;
+      break;
+    case SWIG_TOKEN_LSHIFT:
+    case SWIG_TOKEN_RSHIFT:
+      wide = stack[sp - 2].wide;
+      break;
+    default:
+      wide = UNARY_OP(op_token) ? stack[sp].wide : (stack[sp - 2].wide || stack[sp].wide);
+      break;
+    }
     switch (op_token) {
     case SWIG_TOKEN_STAR:
       stack[sp - 2].value = stack[sp - 2].value * stack[sp].value;
@@ -188,10 +265,18 @@ static int reduce_op() {
       sp--;
       break;
     case SWIG_TOKEN_SLASH:
+      if (stack[sp].value == 0) {
+	errmsg = "Division by zero";
+	return 0;
+      }
       stack[sp - 2].value = stack[sp - 2].value / stack[sp].value;
       sp -= 2;
       break;
     case SWIG_TOKEN_PERCENT:
+      if (stack[sp].value == 0) {
+	errmsg = "Division by zero";
+	return 0;
+      }
       stack[sp - 2].value = stack[sp - 2].value % stack[sp].value;
       sp -= 2;
       break;
@@ -211,6 +296,16 @@ static int reduce_op() {
   }
   stack[sp].op = EXPR_VALUE;
   stack[sp].svalue = 0;		/* ensure it's not a string! */
+  stack[sp].wide = wide;
+  if (stack[sp].value < 0)
+    expr_negative = 1;
+  /* Without long operands C computes in int or unsigned int, so the long result must fit these */
+  if (expr_constant && !wide &&
+      ((stack[sp].value < -2147483647L - 1) || ((stack[sp].value > 2147483647L) && !(expr_unsigned && expr_uint(stack[sp].value))))) {
+    errmsg = "Integer overflow";
+    expr_overflowed = 1;
+    return 0;
+  }
   return 1;
 }
 
@@ -247,12 +342,85 @@ static int expr_token(Scanner * s) {
 }
 
 /* -----------------------------------------------------------------------------
- * Preprocessor_expr()
+ * expr_number()
+ *
+ * Converts the number being scanned, checking for overflow in constant mode.
+ * ----------------------------------------------------------------------------- */
+
+static int expr_number(int token, exprval *e) {
+  char *c = Char(Scanner_text(scan));
+  errno = 0;
+  e->value = strtol(c, 0, 0);
+  e->wide = 0;
+  if (expr_constant) {
+    if (errno == ERANGE) {
+      errmsg = "Integer overflow";
+      expr_overflowed = 1;
+      return 0;
+    }
+    if ((token == SWIG_TOKEN_UINT) || (token == SWIG_TOKEN_ULONG) || (token == SWIG_TOKEN_ULONGLONG))
+      expr_unsigned = 1;
+    if ((token == SWIG_TOKEN_LONG) || (token == SWIG_TOKEN_ULONG) || (token == SWIG_TOKEN_LONGLONG) || (token == SWIG_TOKEN_ULONGLONG))
+      e->wide = 1;
+    else if ((e->value > 2147483647L) && expr_uint(e->value) && (c[0] == '0'))
+      expr_unsigned = 1;	/* An octal or hexadecimal literal of type unsigned int */
+    else if (e->value > 2147483647L)
+      e->wide = 1;
+  }
+  return 1;
+}
+
+/* -----------------------------------------------------------------------------
+ * expr_identifier()
+ *
+ * Gets the value of an identifier in constant mode, either sizeof applied to a
+ * character type or one of the identifiers in expr_values.
+ * ----------------------------------------------------------------------------- */
+
+static int expr_identifier(exprval *e) {
+  String *name = Scanner_text(scan);
+  if (Equal(name, "sizeof")) {
+    int token = expr_token(scan);
+    int is_char = 0;
+    if (token != SWIG_TOKEN_LPAREN) {
+      errmsg = "Syntax error: expected '(' after sizeof";
+      return 0;
+    }
+    while ((token = expr_token(scan)) == SWIG_TOKEN_ID) {
+      String *id = Scanner_text(scan);
+      if (Equal(id, "char"))
+	is_char = 1;
+      else if (!Equal(id, "signed") && !Equal(id, "unsigned"))
+	break;
+    }
+    if (token != SWIG_TOKEN_RPAREN || !is_char) {
+      errmsg = "sizeof is only supported for the character types";
+      return 0;
+    }
+    e->value = 1;
+    e->wide = 1;
+    expr_unsigned = 1;		/* size_t */
+  } else {
+    String *s = expr_values ? Getattr(expr_values, name) : 0;
+    if (!s) {
+      errmsg = "Unknown identifier";
+      return 0;
+    }
+    e->value = strtol(Char(s), 0, 0);
+    e->wide = e->value < -2147483647L - 1 || e->value > 2147483647L;
+  }
+  if (e->value < 0)
+    expr_negative = 1;
+  return 1;
+}
+
+/* -----------------------------------------------------------------------------
+ * expr_evaluate()
  *
  * Evaluates an arithmetic expression.  Returns the result and sets an error code.
  * ----------------------------------------------------------------------------- */
 
-int Preprocessor_expr(DOH *s, int *error) {
+static long expr_evaluate(DOH *s, int *error) {
   int token = 0;
   int op = 0;
 
@@ -281,10 +449,13 @@ int Preprocessor_expr(DOH *s, int *error) {
 	*error = 1;
 	return 0;
       }
-      if ((token == SWIG_TOKEN_INT) || (token == SWIG_TOKEN_UINT) || (token == SWIG_TOKEN_LONG) || (token == SWIG_TOKEN_ULONG)) {
+      if ((token == SWIG_TOKEN_INT) || (token == SWIG_TOKEN_UINT) || (token == SWIG_TOKEN_LONG) || (token == SWIG_TOKEN_ULONG) ||
+	  (expr_constant && ((token == SWIG_TOKEN_LONGLONG) || (token == SWIG_TOKEN_ULONGLONG)))) {
 	/* A number.  Reduce EXPR_TOP to an EXPR_VALUE */
-	char *c = Char(Scanner_text(scan));
-	stack[sp].value = (long) strtol(c, 0, 0);
+	if (!expr_number(token, &stack[sp])) {
+	  *error = 1;
+	  return 0;
+	}
 	stack[sp].svalue = 0;
 	/*        stack[sp].value = (long) atol(Char(Scanner_text(scan))); */
 	stack[sp].op = EXPR_VALUE;
@@ -302,13 +473,18 @@ int Preprocessor_expr(DOH *s, int *error) {
 	stack[sp].value = 0;
 	stack[sp].svalue = 0;
       } else if (token == SWIG_TOKEN_ENDLINE) {
-      } else if (token == SWIG_TOKEN_STRING) {
+      } else if (token == SWIG_TOKEN_STRING && !expr_constant) {
 	stack[sp].svalue = NewString(Scanner_text(scan));
 	stack[sp].op = EXPR_VALUE;
       } else if (token == SWIG_TOKEN_ID) {
 	stack[sp].value = 0;
 	stack[sp].svalue = 0;
 	stack[sp].op = EXPR_VALUE;
+	stack[sp].wide = 0;
+	if (expr_constant && !expr_identifier(&stack[sp])) {
+	  *error = 1;
+	  return 0;
+	}
       } else
 	goto syntax_error;
       break;
@@ -328,6 +504,11 @@ int Preprocessor_expr(DOH *s, int *error) {
 	  } else
 	    goto syntax_error;
 	}
+	if (expr_constant && expr_unsigned && expr_negative) {
+	  errmsg = "Unsigned arithmetic with negative values is not supported";
+	  *error = 1;
+	  return 0;
+	}
 	return stack[sp].value;
       }
       /* Token must be an operator */
@@ -392,6 +573,7 @@ int Preprocessor_expr(DOH *s, int *error) {
 	  goto extra_rparen;
 	stack[sp - 1].op = EXPR_VALUE;
 	stack[sp - 1].value = stack[sp].value;
+	stack[sp - 1].wide = stack[sp].wide;
 	sp--;
 	break;
       default:
@@ -427,6 +609,46 @@ extra_rparen:
   return 0;
 }
 
+/* -----------------------------------------------------------------------------
+ * Preprocessor_expr()
+ *
+ * Evaluates a preprocessor #if expression.  Returns the result and sets an error code.
+ * ----------------------------------------------------------------------------- */
+
+int Preprocessor_expr(DOH *s, int *error) {
+  expr_constant = 0;
+  expr_values = 0;
+  return (int) expr_evaluate(s, error);
+}
+
+/* -----------------------------------------------------------------------------
+ * Preprocessor_expr_constant()
+ *
+ * Evaluates an integral constant expression, such as the value of a constant or
+ * an enum item, so that target languages can use the resulting value instead of
+ * the C expression. Unlike in a preprocessor expression, identifiers must be
+ * found in the values hash, which maps names to the values already evaluated,
+ * and sizeof can be applied to the character types. An error is set for
+ * anything which cannot be evaluated reliably, including strings, other
+ * identifiers and unsigned arithmetic involving negative values. The error is 2
+ * if the value overflows a long or, without long operands, an int.
+ * ----------------------------------------------------------------------------- */
+
+long Preprocessor_expr_constant(DOH *s, Hash *values, int *error) {
+  long value;
+  expr_constant = 1;
+  expr_values = values;
+  expr_unsigned = 0;
+  expr_negative = 0;
+  expr_overflowed = 0;
+  value = expr_evaluate(s, error);
+  if (*error && expr_overflowed)
+    *error = 2;
+  expr_constant = 0;
+  expr_values = 0;
+  return value;
+}
+
 /* -----------------------------------------------------------------------------
  * Preprocessor_expr_error()
  *
@@ -0,0 +1,26 @@
+/* Overloaded functions and methods, resolved by the generated dispatch functions */
+%module dispatch
+
+%include <std_string.i>
+
+%inline %{
+#include <string>
+
+struct Base { virtual ~Base() {} };
+struct Derived : Base {};
+struct Other {};
+
+int over(Base *) { return 1; }
+int over(Other *) { return 2; }
+int over(int) { return 3; }
+int over(double) { return 4; }
+int over(const std::string &) { return 5; }
+int over(Base *, int) { return 6; }
+int over(Base *, double) { return 7; }
+
+struct Klass {
+  int method(int) { return 10; }
+  int method(double) { return 11; }
+  int method(Base *) { return 12; }
+};
+%}
@@ -0,0 +1,42 @@
+/* Calls overloaded functions with a fixed mix of argument types. Built with
+   and without -dispatchcache to compare the cost of overload resolution. */
+
+#include "mexstub.h"
+
+#include <stdio.h>
+#include <time.h>
+
+extern "C" void mexFunction(int resc, mxArray *resv[], int argc, const mxArray *argv[]);
+
+int main(int argc, char **argv) {
+  const char *variant = argc > 1 ? argv[1] : "";
+  const int n = 20000;
+  mexstub::Module m(mexFunction);
+  mxArray *d = m.call("new_Derived");
+  mxArray *o = m.call("new_Other");
+  mxArray *k = m.call("new_Klass");
+  mxArray *i3 = mxCreateNumericMatrix(1, 1, mxINT32_CLASS, mxREAL);
+  mxArray *d3 = mexstub::scalar(3);
+  mxArray *d35 = mexstub::scalar(3.5);
+  mxArray *str = mexstub::string("hello");
+
+  mexstub::reset_stats();
+  clock_t start = clock();
+  for (int i = 0; i < n; ++i) {
+    mxDestroyArray(m.call("over", d));
+    mxDestroyArray(m.call("over", o));
+    mxDestroyArray(m.call("over", i3));
+    mxDestroyArray(m.call("over", d35));
+    mxDestroyArray(m.call("over", str));
+    mxDestroyArray(m.call("over", d, d3));
+    mxDestroyArray(m.call("over", d, d35));
+    mxDestroyArray(m.call("Klass_method", k, d3));
+    mxDestroyArray(m.call("Klass_method", k, d35));
+    mxDestroyArray(m.call("Klass_method", k, d));
+  }
+  double t = (double)(clock() - start) / CLOCKS_PER_SEC;
+  unsigned long calls = 10UL * n;
+  fprintf(stderr, "dispatch%-16s %8.0f calls/s, %5.2f interpreter calls/call\n", variant,
+         calls / t, (double)mexstub::stats().interp_calls / calls);
+  return 0;
+}
@@ -0,0 +1,28 @@
+/* Matrices passed as std::vector<std::vector<double> >, as cell arrays or,
+   with -DDENSE, as dense matrices (matrix.i) */
+%module matrices
+
+#ifdef DENSE
+%include <matrix.i>
+#else
+%include <std_vector.i>
+#endif
+
+%template(DoubleVector) std::vector<double>;
+%template(DoubleMatrix) std::vector<std::vector<double> >;
+
+%inline %{
+std::vector<std::vector<double> > identity(int n) {
+  std::vector<std::vector<double> > m(n, std::vector<double>(n));
+  for (int i = 0; i < n; ++i)
+    m[i][i] = 1;
+  return m;
+}
+
+double trace(const std::vector<std::vector<double> > &m) {
+  double t = 0;
+  for (size_t i = 0; i < m.size(); ++i)
+    t += m[i][i];
+  return t;
+}
+%}
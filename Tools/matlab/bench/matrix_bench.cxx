@@ -0,0 +1,29 @@
+/* Returns a 200x200 matrix from C++ and passes it back, built with and
+   without -DDENSE to compare nested cell arrays with dense matrices. */
+
+#include "mexstub.h"
+
+#include <stdio.h>
+#include <time.h>
+
+extern "C" void mexFunction(int resc, mxArray *resv[], int argc, const mxArray *argv[]);
+
+int main(int argc, char **argv) {
+  const char *variant = argc > 1 ? argv[1] : "";
+  const int n = 200;
+  mexstub::Module m(mexFunction);
+  mxArray *size = mexstub::scalar(n);
+
+  mexstub::reset_stats();
+  clock_t start = clock();
+  const int rounds = 50;
+  for (int i = 0; i < rounds; ++i) {
+    mxArray *id = m.call("identity", size);
+    mxDestroyArray(m.call("trace", id));
+    mxDestroyArray(id);
+  }
+  double t = (double)(clock() - start) / CLOCKS_PER_SEC;
+  fprintf(stderr, "matrix%-18s %8.0f round trips/s, %lu mxArrays/round trip\n", variant,
+          rounds / t, mexstub::stats().arrays_created / rounds);
+  return 0;
+}
@@ -0,0 +1,169 @@
+/* -----------------------------------------------------------------------------
+ * This file is part of SWIG, which is licensed as a whole under version 3
+ * (or any later version) of the GNU General Public License. Some additional
+ * terms also apply to certain portions of SWIG. The full details of the SWIG
+ * license and copyrights can be found in the LICENSE and COPYRIGHT files
+ * included with the SWIG source code as distributed by the SWIG developers
+ * and at http://www.swig.org/legal.html.
+ *
+ * mex.h
+ *
+ * Stand-in for the subset of MATLAB's mx/mex C API used by the SWIG MATLAB
+ * runtime (Lib/matlab) and the code generated by Source/Modules/matlab.cxx.
+ * Together with mexstub.cxx it allows generated gateways to be compiled and
+ * driven from C++ without a MATLAB installation, see README.
+ * ----------------------------------------------------------------------------- */
+
+#ifndef MEXSTUB_MEX_H
+#define MEXSTUB_MEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Basic types, as in tmwtypes.h */
+typedef int8_t   int8_T;
+typedef uint8_t  uint8_T;
+typedef int16_t  int16_T;
+typedef uint16_t uint16_T;
+typedef int32_t  int32_T;
+typedef uint32_t uint32_T;
+typedef int64_t  int64_T;
+typedef uint64_t uint64_T;
+typedef float    real32_T;
+typedef double   real64_T;
+
+typedef size_t    mwSize;
+typedef size_t    mwIndex;
+typedef ptrdiff_t mwSignedIndex;
+
+#ifdef __cplusplus
+typedef bool mxLogical;
+#else
+typedef unsigned char mxLogical;
+#endif
+typedef uint16_t mxChar;
+
+typedef struct mxArray_tag mxArray;
+
+typedef enum {
+  mxUNKNOWN_CLASS = 0,
+  mxCELL_CLASS,
+  mxSTRUCT_CLASS,
+  mxLOGICAL_CLASS,
+  mxCHAR_CLASS,
+  mxVOID_CLASS,
+  mxDOUBLE_CLASS,
+  mxSINGLE_CLASS,
+  mxINT8_CLASS,
+  mxUINT8_CLASS,
+  mxINT16_CLASS,
+  mxUINT16_CLASS,
+  mxINT32_CLASS,
+  mxUINT32_CLASS,
+  mxINT64_CLASS,
+  mxUINT64_CLASS,
+  mxFUNCTION_CLASS,
+  mxOPAQUE_CLASS,
+  mxOBJECT_CLASS
+} mxClassID;
+
+typedef enum {
+  mxREAL,
+  mxCOMPLEX
+} mxComplexity;
+
+/* Memory */
+void *mxMalloc(size_t n);
+void *mxCalloc(size_t n, size_t size);
+void *mxRealloc(void *ptr, size_t size);
+void mxFree(void *ptr);
+
+/* Creation and destruction */
+mxArray *mxCreateNumericMatrix(mwSize m, mwSize n, mxClassID classid, mxComplexity flag);
+mxArray *mxCreateNumericArray(mwSize ndim, const mwSize *dims, mxClassID classid, mxComplexity flag);
+mxArray *mxCreateDoubleMatrix(mwSize m, mwSize n, mxComplexity flag);
+mxArray *mxCreateDoubleScalar(double value);
+mxArray *mxCreateLogicalMatrix(mwSize m, mwSize n);
+mxArray *mxCreateLogicalScalar(mxLogical value);
+mxArray *mxCreateString(const char *str);
+mxArray *mxCreateCharArray(mwSize ndim, const mwSize *dims);
+mxArray *mxCreateCellMatrix(mwSize m, mwSize n);
+mxArray *mxCreateCellArray(mwSize ndim, const mwSize *dims);
+mxArray *mxCreateStructMatrix(mwSize m, mwSize n, int nfields, const char **fieldnames);
+mxArray *mxDuplicateArray(const mxArray *pm);
+mxArray *mxCreateSharedDataCopy(const mxArray *pm);
+void mxDestroyArray(mxArray *pm);
+
+/* Type queries */
+mxClassID mxGetClassID(const mxArray *pm);
+const char *mxGetClassName(const mxArray *pm);
+int mxIsClass(const mxArray *pm, const char *name);
+int mxIsNumeric(const mxArray *pm);
+int mxIsDouble(const mxArray *pm);
+int mxIsSingle(const mxArray *pm);
+int mxIsComplex(const mxArray *pm);
+int mxIsSparse(const mxArray *pm);
+int mxIsChar(const mxArray *pm);
+int mxIsLogical(const mxArray *pm);
+int mxIsLogicalScalar(const mxArray *pm);
+int mxIsLogicalScalarTrue(const mxArray *pm);
+int mxIsCell(const mxArray *pm);
+int mxIsStruct(const mxArray *pm);
+int mxIsEmpty(const mxArray *pm);
+
+/* Dimensions */
+size_t mxGetM(const mxArray *pm);
+size_t mxGetN(const mxArray *pm);
+mwSize mxGetNumberOfDimensions(const mxArray *pm);
+const mwSize *mxGetDimensions(const mxArray *pm);
+size_t mxGetNumberOfElements(const mxArray *pm);
+size_t mxGetElementSize(const mxArray *pm);
+
+/* Data access */
+void *mxGetData(const mxArray *pm);
+void *mxGetImagData(const mxArray *pm);
+double *mxGetPr(const mxArray *pm);
+double *mxGetPi(const mxArray *pm);
+mxLogical *mxGetLogicals(const mxArray *pm);
+mxChar *mxGetChars(const mxArray *pm);
+double mxGetScalar(const mxArray *pm);
+int mxGetString(const mxArray *pm, char *str, mwSize strlen);
+char *mxArrayToString(const mxArray *pm);
+
+/* Cell arrays */
+mxArray *mxGetCell(const mxArray *pm, mwIndex i);
+void mxSetCell(mxArray *pm, mwIndex i, mxArray *value);
+
+/* Structs */
+int mxGetNumberOfFields(const mxArray *pm);
+const char *mxGetFieldNameByNumber(const mxArray *pm, int n);
+int mxGetFieldNumber(const mxArray *pm, const char *name);
+int mxAddField(mxArray *pm, const char *name);
+mxArray *mxGetField(const mxArray *pm, mwIndex i, const char *name);
+mxArray *mxGetFieldByNumber(const mxArray *pm, mwIndex i, int n);
+void mxSetField(mxArray *pm, mwIndex i, const char *name, mxArray *value);
+void mxSetFieldByNumber(mxArray *pm, mwIndex i, int n, mxArray *value);
+
+/* MEX interface */
+int mexPrintf(const char *fmt, ...);
+void mexErrMsgTxt(const char *msg);
+void mexErrMsgIdAndTxt(const char *id, const char *fmt, ...);
+void mexWarnMsgTxt(const char *msg);
+void mexWarnMsgIdAndTxt(const char *id, const char *fmt, ...);
+int mexCallMATLAB(int nlhs, mxArray *plhs[], int nrhs, mxArray *prhs[], const char *name);
+mxArray *mexCallMATLABWithTrap(int nlhs, mxArray *plhs[], int nrhs, mxArray *prhs[], const char *name);
+void mexMakeArrayPersistent(mxArray *pm);
+int mexAtExit(void (*fcn)(void));
+void mexLock(void);
+void mexUnlock(void);
+int mexIsLocked(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,857 @@
+/* -----------------------------------------------------------------------------
+ * This file is part of SWIG, which is licensed as a whole under version 3
+ * (or any later version) of the GNU General Public License. Some additional
+ * terms also apply to certain portions of SWIG. The full details of the SWIG
+ * license and copyrights can be found in the LICENSE and COPYRIGHT files
+ * included with the SWIG source code as distributed by the SWIG developers
+ * and at http://www.swig.org/legal.html.
+ *
+ * mexstub.cxx
+ *
+ * Stand-in implementation of the mx/mex C API declared in mex.h. Only the
+ * parts of MATLAB the SWIG runtime relies on are emulated: numeric, logical,
+ * char, cell and struct arrays, handle objects with properties, the helper
+ * functions generated by the MATLAB module (SwigRef, SwigGet, SwigSet,
+ * SwigMem, SwigStorage) and user defined interpreter functions.
+ * ----------------------------------------------------------------------------- */
+
+#include "mexstub.h"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+namespace {
+
+  enum State {
+    TEMPORARY,  /* Created during a gateway call, freed when it returns */
+    OWNED       /* Owned by the caller, a container, an object or persistent */
+  };
+
+  /* Handle object shared by all arrays referring to it */
+  struct Object {
+    std::string classname;
+    std::map<std::string, mxArray *> props;
+    int refcount;
+  };
+
+}
+
+struct mxArray_tag {
+  mxClassID classid;
+  bool complex;
+  std::vector<mwSize> dims;
+  void *pr;
+  void *pi;
+  /* Cell elements, or struct fields (numel*nfields, element major) */
+  std::vector<mxArray *> elems;
+  std::vector<std::string> fields;
+  Object *obj;
+  /* Temporaries are kept in a doubly linked list */
+  State state;
+  mxArray *prev;
+  mxArray *next;
+};
+
+namespace {
+
+  mexstub::Stats stats;
+  bool discard = false;
+  int call_depth = 0;
+  int lock_count = 0;
+  mxArray *temporaries = 0;
+  std::map<std::string, mexstub::Function> functions;
+  mxArray *swig_mem = 0;
+  std::map<std::string, mxArray *> swig_storage;
+  std::vector<void (*)(void)> exit_fcns;
+
+  void link(mxArray *pm) {
+    pm->state = TEMPORARY;
+    pm->prev = 0;
+    pm->next = temporaries;
+    if (temporaries) temporaries->prev = pm;
+    temporaries = pm;
+  }
+
+  void unlink(mxArray *pm) {
+    if (pm->state != TEMPORARY) return;
+    if (pm->prev) pm->prev->next = pm->next;
+    else temporaries = pm->next;
+    if (pm->next) pm->next->prev = pm->prev;
+    pm->prev = pm->next = 0;
+    pm->state = OWNED;
+  }
+
+  /* Take ownership of an array and everything it contains */
+  void own(mxArray *pm) {
+    if (!pm) return;
+    unlink(pm);
+    for (size_t i = 0; i < pm->elems.size(); ++i) own(pm->elems[i]);
+  }
+
+  size_t element_size(mxClassID classid) {
+    switch (classid) {
+    case mxLOGICAL_CLASS: return sizeof(mxLogical);
+    case mxCHAR_CLASS: return sizeof(mxChar);
+    case mxDOUBLE_CLASS: return sizeof(double);
+    case mxSINGLE_CLASS: return sizeof(float);
+    case mxINT8_CLASS:
+    case mxUINT8_CLASS: return 1;
+    case mxINT16_CLASS:
+    case mxUINT16_CLASS: return 2;
+    case mxINT32_CLASS:
+    case mxUINT32_CLASS: return 4;
+    case mxINT64_CLASS:
+    case mxUINT64_CLASS: return 8;
+    case mxCELL_CLASS:
+    case mxSTRUCT_CLASS: return sizeof(mxArray *);
+    default: return 0;
+    }
+  }
+
+  size_t numel(const mxArray *pm) {
+    size_t n = 1;
+    for (size_t i = 0; i < pm->dims.size(); ++i) n *= pm->dims[i];
+    return n;
+  }
+
+  mxArray *create(mxClassID classid, mwSize ndim, const mwSize *dims, bool complex) {
+    mxArray *pm = new mxArray;
+    pm->classid = classid;
+    pm->complex = complex;
+    pm->dims.assign(dims, dims + ndim);
+    while (pm->dims.size() < 2) pm->dims.push_back(1);
+    pm->pr = pm->pi = 0;
+    pm->obj = 0;
+    size_t n = numel(pm);
+    size_t sz = element_size(classid);
+    if (classid == mxCELL_CLASS) {
+      pm->elems.resize(n, 0);
+    } else if (sz && classid != mxSTRUCT_CLASS) {
+      pm->pr = calloc(n ? n : 1, sz);
+      if (complex) pm->pi = calloc(n ? n : 1, sz);
+    }
+    stats.arrays_created++;
+    stats.arrays_live++;
+    if (call_depth > 0) {
+      link(pm);
+    } else {
+      pm->state = OWNED;
+      pm->prev = pm->next = 0;
+    }
+    return pm;
+  }
+
+  mxArray *create2(mxClassID classid, mwSize m, mwSize n, bool complex) {
+    mwSize dims[2] = {m, n};
+    return create(classid, 2, dims, complex);
+  }
+
+  void release(Object *obj) {
+    if (obj && --obj->refcount == 0) {
+      for (std::map<std::string, mxArray *>::iterator it = obj->props.begin(); it != obj->props.end(); ++it)
+        mxDestroyArray(it->second);
+      delete obj;
+    }
+  }
+
+  /* Free the array itself but not the arrays it contains */
+  void free_shallow(mxArray *pm) {
+    unlink(pm);
+    free(pm->pr);
+    free(pm->pi);
+    release(pm->obj);
+    stats.arrays_live--;
+    delete pm;
+  }
+
+  /* Free temporaries left over when a gateway call returns */
+  void collect() {
+    while (temporaries) free_shallow(temporaries);
+  }
+
+  mxArray *object(Object *obj) {
+    mxArray *pm = create2(mxOBJECT_CLASS, 1, 1, false);
+    pm->obj = obj;
+    obj->refcount++;
+    return pm;
+  }
+
+  mxArray *new_object(const char *classname) {
+    Object *obj = new Object;
+    obj->classname = classname;
+    obj->refcount = 0;
+    return object(obj);
+  }
+
+  mxArray *empty() {
+    return create2(mxDOUBLE_CLASS, 0, 0, false);
+  }
+
+  /* Persistent copy of an array */
+  mxArray *keep(const mxArray *pm) {
+    mxArray *r = mxDuplicateArray(pm);
+    own(r);
+    return r;
+  }
+
+  void set_prop(Object *obj, const char *name, const mxArray *value) {
+    mxArray *&p = obj->props[name];
+    if (p) mxDestroyArray(p);
+    p = keep(value);
+  }
+
+  std::string vformat(const char *fmt, va_list args) {
+    char buf[4096];
+    vsnprintf(buf, sizeof(buf), fmt, args);
+    return buf;
+  }
+
+  /* Built in interpreter functions */
+
+  int builtin_SwigRef(int nlhs, mxArray *plhs[], int nrhs, mxArray *[]) {
+    if (nrhs != 0 || nlhs > 1) mexErrMsgIdAndTxt("MATLAB:TooManyInputs", "SwigRef: wrong number of arguments");
+    plhs[0] = new_object("SwigRef");
+    set_prop(plhs[0]->obj, "swigPtr", empty());
+    return 0;
+  }
+
+  int builtin_SwigGet(int nlhs, mxArray *plhs[], int nrhs, mxArray *prhs[]) {
+    if (nrhs != 1 || nlhs > 1) mexErrMsgIdAndTxt("MATLAB:TooManyInputs", "SwigGet: wrong number of arguments");
+    Object *obj = prhs[0]->obj;
+    mxArray *p = 0;
+    if (obj) {
+      std::map<std::string, mxArray *>::iterator it = obj->props.find("swigPtr");
+      if (it != obj->props.end()) p = it->second;
+    }
+    plhs[0] = p ? mxDuplicateArray(p) : empty();
+    return 0;
+  }
+
+  int builtin_SwigSet(int nlhs, mxArray *[], int nrhs, mxArray *prhs[]) {
+    if (nrhs != 2 || nlhs > 0) mexErrMsgIdAndTxt("MATLAB:TooManyInputs", "SwigSet: wrong number of arguments");
+    if (!prhs[0]->obj) mexErrMsgIdAndTxt("MATLAB:UndefinedFunction", "SwigSet: not an object");
+    set_prop(prhs[0]->obj, "swigPtr", prhs[1]);
+    return 0;
+  }
+
+  int builtin_SwigMem(int nlhs, mxArray *plhs[], int nrhs, mxArray *prhs[]) {
+    if (nrhs == 0) {
+      if (nlhs > 1) mexErrMsgIdAndTxt("MATLAB:TooManyOutputs", "SwigMem: wrong number of arguments");
+      plhs[0] = swig_mem ? mxDuplicateArray(swig_mem) : empty();
+    } else if (nrhs == 1 && nlhs == 0) {
+      if (swig_mem) mxDestroyArray(swig_mem);
+      swig_mem = keep(prhs[0]);
+    } else {
+      mexErrMsgIdAndTxt("MATLAB:TooManyInputs", "SwigMem: wrong number of arguments");
+    }
+    return 0;
+  }
+
+  int builtin_SwigStorage(int nlhs, mxArray *plhs[], int nrhs, mxArray *prhs[]) {
+    if (nrhs < 1 || nrhs > 2) mexErrMsgIdAndTxt("MATLAB:TooManyInputs", "SwigStorage: wrong number of arguments");
+    std::string field = mexstub::to_string(prhs[0]);
+    std::map<std::string, mxArray *>::iterator it = swig_storage.find(field);
+    if (nrhs == 1) {
+      if (nlhs > 1) mexErrMsgIdAndTxt("MATLAB:TooManyOutputs", "SwigStorage: wrong number of arguments");
+      if (it == swig_storage.end()) mexErrMsgIdAndTxt("MATLAB:nonExistentField", "Reference to non-existent field '%s'.", field.c_str());
+      plhs[0] = mxDuplicateArray(it->second);
+    } else {
+      if (it != swig_storage.end()) {
+        mxDestroyArray(it->second);
+        swig_storage.erase(it);
+      }
+      if (!mxIsEmpty(prhs[1])) swig_storage[field] = keep(prhs[1]);
+    }
+    return 0;
+  }
+
+  int builtin_throw(int, mxArray *[], int nrhs, mxArray *prhs[]) {
+    if (nrhs != 1 || !prhs[0]->obj) mexErrMsgIdAndTxt("MATLAB:throw", "throw: expected an MException");
+    Object *obj = prhs[0]->obj;
+    throw mexstub::Error(mexstub::to_string(obj->props["identifier"]), mexstub::to_string(obj->props["message"]));
+  }
+
+  void define_builtins() {
+    if (!functions.empty()) return;
+    functions["SwigRef"] = builtin_SwigRef;
+    functions["SwigGet"] = builtin_SwigGet;
+    functions["SwigSet"] = builtin_SwigSet;
+    functions["SwigMem"] = builtin_SwigMem;
+    functions["SwigStorage"] = builtin_SwigStorage;
+    functions["throw"] = builtin_throw;
+  }
+
+  void interp(int nlhs, mxArray *plhs[], int nrhs, mxArray *prhs[], const char *name) {
+    define_builtins();
+    stats.interp_calls++;
+    mexstub::Function f = 0;
+    std::map<std::string, mexstub::Function>::iterator it;
+    /* Methods take precedence, like MATLAB's dispatch on the first argument */
+    if (nrhs > 0 && prhs[0]->obj) {
+      it = functions.find(prhs[0]->obj->classname + "." + name);
+      if (it != functions.end()) f = it->second;
+    }
+    if (!f) {
+      it = functions.find(name);
+      if (it != functions.end()) f = it->second;
+    }
+    if (f) {
+      call_depth++;
+      try {
+        f(nlhs, plhs, nrhs, prhs);
+      } catch (...) {
+        call_depth--;
+        throw;
+      }
+      call_depth--;
+      return;
+    }
+    /* Proxy class constructor called with a SwigRef, as done by SWIG_Matlab_NewPointerObj */
+    if (nrhs == 1 && nlhs <= 1 && prhs[0]->obj && prhs[0]->obj->classname == "SwigRef") {
+      plhs[0] = new_object(name);
+      mxArray *p = prhs[0]->obj->props["swigPtr"];
+      set_prop(plhs[0]->obj, "swigPtr", p ? p : empty());
+      return;
+    }
+    mexErrMsgIdAndTxt("MATLAB:UndefinedFunction", "Undefined function or variable '%s'.", name);
+  }
+}
+
+extern "C" {
+
+void *mxMalloc(size_t n) {
+  return malloc(n);
+}
+
+void *mxCalloc(size_t n, size_t size) {
+  return calloc(n, size);
+}
+
+void *mxRealloc(void *ptr, size_t size) {
+  return realloc(ptr, size);
+}
+
+void mxFree(void *ptr) {
+  free(ptr);
+}
+
+mxArray *mxCreateNumericMatrix(mwSize m, mwSize n, mxClassID classid, mxComplexity flag) {
+  return create2(classid, m, n, flag == mxCOMPLEX);
+}
+
+mxArray *mxCreateNumericArray(mwSize ndim, const mwSize *dims, mxClassID classid, mxComplexity flag) {
+  return create(classid, ndim, dims, flag == mxCOMPLEX);
+}
+
+mxArray *mxCreateDoubleMatrix(mwSize m, mwSize n, mxComplexity flag) {
+  return create2(mxDOUBLE_CLASS, m, n, flag == mxCOMPLEX);
+}
+
+mxArray *mxCreateDoubleScalar(double value) {
+  mxArray *pm = create2(mxDOUBLE_CLASS, 1, 1, false);
+  *(double *)pm->pr = value;
+  return pm;
+}
+
+mxArray *mxCreateLogicalMatrix(mwSize m, mwSize n) {
+  return create2(mxLOGICAL_CLASS, m, n, false);
+}
+
+mxArray *mxCreateLogicalScalar(mxLogical value) {
+  mxArray *pm = create2(mxLOGICAL_CLASS, 1, 1, false);
+  *(mxLogical *)pm->pr = value;
+  return pm;
+}
+
+mxArray *mxCreateString(const char *str) {
+  size_t len = str ? strlen(str) : 0;
+  mxArray *pm = create2(mxCHAR_CLASS, len ? 1 : 0, len, false);
+  mxChar *c = (mxChar *)pm->pr;
+  for (size_t i = 0; i < len; ++i) c[i] = (mxChar)(unsigned char)str[i];
+  return pm;
+}
+
+mxArray *mxCreateCharArray(mwSize ndim, const mwSize *dims) {
+  return create(mxCHAR_CLASS, ndim, dims, false);
+}
+
+mxArray *mxCreateCellMatrix(mwSize m, mwSize n) {
+  return create2(mxCELL_CLASS, m, n, false);
+}
+
+mxArray *mxCreateCellArray(mwSize ndim, const mwSize *dims) {
+  return create(mxCELL_CLASS, ndim, dims, false);
+}
+
+mxArray *mxCreateStructMatrix(mwSize m, mwSize n, int nfields, const char **fieldnames) {
+  mxArray *pm = create2(mxSTRUCT_CLASS, m, n, false);
+  for (int i = 0; i < nfields; ++i) pm->fields.push_back(fieldnames[i]);
+  pm->elems.resize(numel(pm) * nfields, 0);
+  return pm;
+}
+
+mxArray *mxDuplicateArray(const mxArray *pm) {
+  if (!pm) return 0;
+  mxArray *r = create(pm->classid, pm->dims.size(), &pm->dims[0], pm->complex);
+  size_t nbytes = numel(pm) * element_size(pm->classid);
+  if (pm->pr && nbytes) memcpy(r->pr, pm->pr, nbytes);
+  if (pm->pi && nbytes) memcpy(r->pi, pm->pi, nbytes);
+  r->fields = pm->fields;
+  r->elems.resize(pm->elems.size(), 0);
+  for (size_t i = 0; i < pm->elems.size(); ++i) {
+    r->elems[i] = mxDuplicateArray(pm->elems[i]);
+    unlink(r->elems[i]);
+  }
+  if (pm->obj) {
+    r->obj = pm->obj;
+    r->obj->refcount++;
+  }
+  return r;
+}
+
+mxArray *mxCreateSharedDataCopy(const mxArray *pm) {
+  return mxDuplicateArray(pm);
+}
+
+void mxDestroyArray(mxArray *pm) {
+  if (!pm) return;
+  for (size_t i = 0; i < pm->elems.size(); ++i) mxDestroyArray(pm->elems[i]);
+  free_shallow(pm);
+}
+
+mxClassID mxGetClassID(const mxArray *pm) {
+  return pm->classid;
+}
+
+const char *mxGetClassName(const mxArray *pm) {
+  switch (pm->classid) {
+  case mxCELL_CLASS: return "cell";
+  case mxSTRUCT_CLASS: return "struct";
+  case mxLOGICAL_CLASS: return "logical";
+  case mxCHAR_CLASS: return "char";
+  case mxDOUBLE_CLASS: return "double";
+  case mxSINGLE_CLASS: return "single";
+  case mxINT8_CLASS: return "int8";
+  case mxUINT8_CLASS: return "uint8";
+  case mxINT16_CLASS: return "int16";
+  case mxUINT16_CLASS: return "uint16";
+  case mxINT32_CLASS: return "int32";
+  case mxUINT32_CLASS: return "uint32";
+  case mxINT64_CLASS: return "int64";
+  case mxUINT64_CLASS: return "uint64";
+  case mxFUNCTION_CLASS: return "function_handle";
+  case mxOBJECT_CLASS: return pm->obj ? pm->obj->classname.c_str() : "unknown";
+  default: return "unknown";
+  }
+}
+
+int mxIsClass(const mxArray *pm, const char *name) {
+  return strcmp(mxGetClassName(pm), name) == 0;
+}
+
+int mxIsNumeric(const mxArray *pm) {
+  return pm->classid >= mxDOUBLE_CLASS && pm->classid <= mxUINT64_CLASS;
+}
+
+int mxIsDouble(const mxArray *pm) {
+  return pm->classid == mxDOUBLE_CLASS;
+}
+
+int mxIsSingle(const mxArray *pm) {
+  return pm->classid == mxSINGLE_CLASS;
+}
+
+int mxIsComplex(const mxArray *pm) {
+  return pm->complex;
+}
+
+int mxIsSparse(const mxArray *) {
+  return 0;
+}
+
+int mxIsChar(const mxArray *pm) {
+  return pm->classid == mxCHAR_CLASS;
+}
+
+int mxIsLogical(const mxArray *pm) {
+  return pm->classid == mxLOGICAL_CLASS;
+}
+
+int mxIsLogicalScalar(const mxArray *pm) {
+  return pm->classid == mxLOGICAL_CLASS && numel(pm) == 1;
+}
+
+int mxIsLogicalScalarTrue(const mxArray *pm) {
+  return mxIsLogicalScalar(pm) && *(mxLogical *)pm->pr;
+}
+
+int mxIsCell(const mxArray *pm) {
+  return pm->classid == mxCELL_CLASS;
+}
+
+int mxIsStruct(const mxArray *pm) {
+  return pm->classid == mxSTRUCT_CLASS;
+}
+
+int mxIsEmpty(const mxArray *pm) {
+  return numel(pm) == 0;
+}
+
+size_t mxGetM(const mxArray *pm) {
+  return pm->dims[0];
+}
+
+size_t mxGetN(const mxArray *pm) {
+  /* Product of all trailing dimensions */
+  size_t n = 1;
+  for (size_t i = 1; i < pm->dims.size(); ++i) n *= pm->dims[i];
+  return n;
+}
+
+mwSize mxGetNumberOfDimensions(const mxArray *pm) {
+  return pm->dims.size();
+}
+
+const mwSize *mxGetDimensions(const mxArray *pm) {
+  return &pm->dims[0];
+}
+
+size_t mxGetNumberOfElements(const mxArray *pm) {
+  return numel(pm);
+}
+
+size_t mxGetElementSize(const mxArray *pm) {
+  return element_size(pm->classid);
+}
+
+void *mxGetData(const mxArray *pm) {
+  return pm->pr;
+}
+
+void *mxGetImagData(const mxArray *pm) {
+  return pm->pi;
+}
+
+double *mxGetPr(const mxArray *pm) {
+  return pm->classid == mxDOUBLE_CLASS ? (double *)pm->pr : 0;
+}
+
+double *mxGetPi(const mxArray *pm) {
+  return pm->classid == mxDOUBLE_CLASS ? (double *)pm->pi : 0;
+}
+
+mxLogical *mxGetLogicals(const mxArray *pm) {
+  return pm->classid == mxLOGICAL_CLASS ? (mxLogical *)pm->pr : 0;
+}
+
+mxChar *mxGetChars(const mxArray *pm) {
+  return pm->classid == mxCHAR_CLASS ? (mxChar *)pm->pr : 0;
+}
+
+double mxGetScalar(const mxArray *pm) {
+  if (!pm->pr || numel(pm) == 0) return 0;
+  switch (pm->classid) {
+  case mxLOGICAL_CLASS: return *(mxLogical *)pm->pr ? 1 : 0;
+  case mxCHAR_CLASS: return *(mxChar *)pm->pr;
+  case mxDOUBLE_CLASS: return *(double *)pm->pr;
+  case mxSINGLE_CLASS: return *(float *)pm->pr;
+  case mxINT8_CLASS: return *(int8_T *)pm->pr;
+  case mxUINT8_CLASS: return *(uint8_T *)pm->pr;
+  case mxINT16_CLASS: return *(int16_T *)pm->pr;
+  case mxUINT16_CLASS: return *(uint16_T *)pm->pr;
+  case mxINT32_CLASS: return *(int32_T *)pm->pr;
+  case mxUINT32_CLASS: return *(uint32_T *)pm->pr;
+  case mxINT64_CLASS: return (double)*(int64_T *)pm->pr;
+  case mxUINT64_CLASS: return (double)*(uint64_T *)pm->pr;
+  default: return 0;
+  }
+}
+
+int mxGetString(const mxArray *pm, char *str, mwSize strlen) {
+  if (pm->classid != mxCHAR_CLASS || strlen == 0) return 1;
+  size_t n = numel(pm);
+  const mxChar *c = (const mxChar *)pm->pr;
+  size_t i;
+  for (i = 0; i < n && i + 1 < strlen; ++i) str[i] = (char)c[i];
+  str[i] = '\0';
+  return i < n ? 1 : 0;
+}
+
+char *mxArrayToString(const mxArray *pm) {
+  if (pm->classid != mxCHAR_CLASS) return 0;
+  size_t n = numel(pm);
+  char *str = (char *)mxMalloc(n + 1);
+  mxGetString(pm, str, n + 1);
+  return str;
+}
+
+mxArray *mxGetCell(const mxArray *pm, mwIndex i) {
+  return pm->classid == mxCELL_CLASS && i < pm->elems.size() ? pm->elems[i] : 0;
+}
+
+void mxSetCell(mxArray *pm, mwIndex i, mxArray *value) {
+  if (pm->classid != mxCELL_CLASS || i >= pm->elems.size()) return;
+  /* The container takes ownership, unless it is itself temporary */
+  if (value && pm->state == OWNED) own(value);
+  pm->elems[i] = value;
+}
+
+int mxGetNumberOfFields(const mxArray *pm) {
+  return (int)pm->fields.size();
+}
+
+const char *mxGetFieldNameByNumber(const mxArray *pm, int n) {
+  return n >= 0 && n < (int)pm->fields.size() ? pm->fields[n].c_str() : 0;
+}
+
+int mxGetFieldNumber(const mxArray *pm, const char *name) {
+  for (size_t i = 0; i < pm->fields.size(); ++i)
+    if (pm->fields[i] == name) return (int)i;
+  return -1;
+}
+
+int mxAddField(mxArray *pm, const char *name) {
+  if (pm->classid != mxSTRUCT_CLASS) return -1;
+  int n = mxGetFieldNumber(pm, name);
+  if (n >= 0) return n;
+  size_t nf = pm->fields.size();
+  std::vector<mxArray *> elems;
+  for (size_t i = 0; i < numel(pm); ++i) {
+    elems.insert(elems.end(), pm->elems.begin() + i * nf, pm->elems.begin() + (i + 1) * nf);
+    elems.push_back(0);
+  }
+  pm->elems.swap(elems);
+  pm->fields.push_back(name);
+  return (int)nf;
+}
+
+mxArray *mxGetFieldByNumber(const mxArray *pm, mwIndex i, int n) {
+  if (pm->classid != mxSTRUCT_CLASS || n < 0 || n >= (int)pm->fields.size() || i >= numel(pm)) return 0;
+  return pm->elems[i * pm->fields.size() + n];
+}
+
+mxArray *mxGetField(const mxArray *pm, mwIndex i, const char *name) {
+  return mxGetFieldByNumber(pm, i, mxGetFieldNumber(pm, name));
+}
+
+void mxSetFieldByNumber(mxArray *pm, mwIndex i, int n, mxArray *value) {
+  if (pm->classid != mxSTRUCT_CLASS || n < 0 || n >= (int)pm->fields.size() || i >= numel(pm)) return;
+  if (value && pm->state == OWNED) own(value);
+  pm->elems[i * pm->fields.size() + n] = value;
+}
+
+void mxSetField(mxArray *pm, mwIndex i, const char *name, mxArray *value) {
+  mxSetFieldByNumber(pm, i, mxGetFieldNumber(pm, name), value);
+}
+
+int mexPrintf(const char *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  std::string s = vformat(fmt, args);
+  va_end(args);
+  stats.prints++;
+  stats.print_bytes += s.size();
+  if (!discard) fputs(s.c_str(), stdout);
+  return (int)s.size();
+}
+
+void mexErrMsgTxt(const char *msg) {
+  throw mexstub::Error("", msg);
+}
+
+void mexErrMsgIdAndTxt(const char *id, const char *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  std::string s = vformat(fmt, args);
+  va_end(args);
+  throw mexstub::Error(id, s);
+}
+
+void mexWarnMsgTxt(const char *msg) {
+  fprintf(stderr, "Warning: %s\n", msg);
+}
+
+void mexWarnMsgIdAndTxt(const char *id, const char *fmt, ...) {
+  va_list args;
+  va_start(args, fmt);
+  std::string s = vformat(fmt, args);
+  va_end(args);
+  fprintf(stderr, "Warning (%s): %s\n", id, s.c_str());
+}
+
+int mexCallMATLAB(int nlhs, mxArray *plhs[], int nrhs, mxArray *prhs[], const char *name) {
+  interp(nlhs, plhs, nrhs, prhs, name);
+  return 0;
+}
+
+mxArray *mexCallMATLABWithTrap(int nlhs, mxArray *plhs[], int nrhs, mxArray *prhs[], const char *name) {
+  try {
+    interp(nlhs, plhs, nrhs, prhs, name);
+  } catch (mexstub::Error &e) {
+    mxArray *ex = new_object("MException");
+    mxArray *id = mxCreateString(e.identifier().c_str());
+    mxArray *msg = mxCreateString(e.what());
+    set_prop(ex->obj, "identifier", id);
+    set_prop(ex->obj, "message", msg);
+    mxDestroyArray(id);
+    mxDestroyArray(msg);
+    return ex;
+  }
+  return 0;
+}
+
+void mexMakeArrayPersistent(mxArray *pm) {
+  own(pm);
+}
+
+int mexAtExit(void (*fcn)(void)) {
+  exit_fcns.push_back(fcn);
+  return 0;
+}
+
+void mexLock(void) {
+  lock_count++;
+}
+
+void mexUnlock(void) {
+  if (lock_count > 0) lock_count--;
+}
+
+int mexIsLocked(void) {
+  return lock_count > 0;
+}
+
+} /* extern "C" */
+
+namespace mexstub {
+
+  void define(const char *name, Function f) {
+    define_builtins();
+    functions[name] = f;
+  }
+
+  void call(Gateway gw, int fcn_id, int nlhs, mxArray *plhs[], int nrhs, mxArray *prhs[]) {
+    std::vector<const mxArray *> args(nrhs + 1);
+    call_depth++;
+    mxArray *id = mxCreateDoubleScalar(fcn_id);
+    args[0] = id;
+    for (int i = 0; i < nrhs; ++i) args[i + 1] = prhs[i];
+    for (int i = 0; i < nlhs; ++i) plhs[i] = 0;
+    try {
+      gw(nlhs, plhs, nrhs + 1, &args[0]);
+    } catch (...) {
+      call_depth--;
+      if (call_depth == 0) collect();
+      throw;
+    }
+    for (int i = 0; i < nlhs; ++i) own(plhs[i]);
+    call_depth--;
+    if (call_depth == 0) collect();
+  }
+
+  void clear_mex() {
+    if (lock_count > 0) throw Error("MATLAB:mex:locked", "MEX file is locked");
+    while (!exit_fcns.empty()) {
+      void (*fcn)(void) = exit_fcns.back();
+      exit_fcns.pop_back();
+      fcn();
+    }
+  }
+
+  void discard_output(bool flag) {
+    discard = flag;
+  }
+
+  const Stats &stats() {
+    return ::stats;
+  }
+
+  void reset_stats() {
+    unsigned long live = ::stats.arrays_live;
+    memset(&::stats, 0, sizeof(::stats));
+    ::stats.arrays_live = live;
+  }
+
+  mxArray *create_object(const char *classname) {
+    return new_object(classname);
+  }
+
+  mxArray *scalar(double value) {
+    return mxCreateDoubleScalar(value);
+  }
+
+  mxArray *string(const char *str) {
+    return mxCreateString(str);
+  }
+
+  double to_double(const mxArray *pm) {
+    if (!pm || numel(pm) != 1) throw Error("mexstub:to_double", "Expected a scalar");
+    return mxGetScalar(pm);
+  }
+
+  std::string to_string(const mxArray *pm) {
+    if (!pm || pm->classid != mxCHAR_CLASS) throw Error("mexstub:to_string", "Expected a char array");
+    const mxChar *c = (const mxChar *)pm->pr;
+    std::string s;
+    for (size_t i = 0; i < numel(pm); ++i) s += (char)c[i];
+    return s;
+  }
+
+  Module::Module(Gateway gw) : gw_(gw) {
+    /* swigFunctionName has ID 1 and maps IDs to names */
+    for (int i = 0;; ++i) {
+      mxArray *arg = scalar(i);
+      mxArray *name = 0;
+      try {
+        mexstub::call(gw_, 1, 1, &name, 1, &arg);
+      } catch (Error &) {
+        mxDestroyArray(arg);
+        break;
+      }
+      ids_[to_string(name)] = i;
+      mxDestroyArray(name);
+      mxDestroyArray(arg);
+    }
+  }
+
+  int Module::id(const char *name) {
+    std::map<std::string, int>::iterator it = ids_.find(name);
+    /* Global functions are listed by wrapper name */
+    if (it == ids_.end()) it = ids_.find(std::string("_wrap_") + name);
+    if (it == ids_.end()) throw Error("mexstub:Module", std::string("No such function: ") + name);
+    return it->second;
+  }
+
+  void Module::call(const char *name, int nlhs, mxArray *plhs[], int nrhs, mxArray *prhs[]) {
+    mexstub::call(gw_, id(name), nlhs, plhs, nrhs, prhs);
+  }
+
+  mxArray *Module::call(const char *name) {
+    mxArray *out = 0;
+    call(name, 1, &out, 0, 0);
+    return out;
+  }
+
+  mxArray *Module::call(const char *name, mxArray *a0) {
+    mxArray *out = 0;
+    call(name, 1, &out, 1, &a0);
+    return out;
+  }
+
+  mxArray *Module::call(const char *name, mxArray *a0, mxArray *a1) {
+    mxArray *args[2] = {a0, a1};
+    mxArray *out = 0;
+    call(name, 1, &out, 2, args);
+    return out;
+  }
+
+  mxArray *Module::call(const char *name, mxArray *a0, mxArray *a1, mxArray *a2) {
+    mxArray *args[3] = {a0, a1, a2};
+    mxArray *out = 0;
+    call(name, 1, &out, 3, args);
+    return out;
+  }
+}
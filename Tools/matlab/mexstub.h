@@ -0,0 +1,102 @@
+/* -----------------------------------------------------------------------------
+ * This file is part of SWIG, which is licensed as a whole under version 3
+ * (or any later version) of the GNU General Public License. Some additional
+ * terms also apply to certain portions of SWIG. The full details of the SWIG
+ * license and copyrights can be found in the LICENSE and COPYRIGHT files
+ * included with the SWIG source code as distributed by the SWIG developers
+ * and at http://www.swig.org/legal.html.
+ *
+ * mexstub.h
+ *
+ * Harness for driving SWIG generated MATLAB gateways (mexFunction) from C++
+ * using the stand-in mx/mex library in mexstub.cxx.
+ * ----------------------------------------------------------------------------- */
+
+#ifndef MEXSTUB_H
+#define MEXSTUB_H
+
+#include "mex.h"
+
+#include <exception>
+#include <map>
+#include <string>
+
+namespace mexstub {
+
+  /* Signature of the gateway, i.e. mexFunction */
+  typedef void (*Gateway)(int nlhs, mxArray *plhs[], int nrhs, const mxArray *prhs[]);
+
+  /* Interpreter function that can be called from the MEX file with mexCallMATLAB */
+  typedef int (*Function)(int nlhs, mxArray *plhs[], int nrhs, mxArray *prhs[]);
+
+  /* Raised by mexErrMsgIdAndTxt and failing interpreter calls */
+  class Error : public std::exception {
+  public:
+    Error(const std::string &id, const std::string &msg) : id_(id), msg_(msg) {}
+    virtual ~Error() throw() {}
+    const char *what() const throw() { return msg_.c_str(); }
+    const std::string &identifier() const { return id_; }
+  private:
+    std::string id_;
+    std::string msg_;
+  };
+
+  /* Counters, mainly of interest to benchmarks */
+  struct Stats {
+    unsigned long arrays_created;   /* mxArrays created */
+    unsigned long arrays_live;      /* mxArrays not yet freed */
+    unsigned long interp_calls;     /* mexCallMATLAB and mexCallMATLABWithTrap calls */
+    unsigned long prints;           /* mexPrintf calls */
+    unsigned long print_bytes;      /* Characters written by mexPrintf */
+  };
+
+  /* Define an interpreter function. Methods of a class are defined as
+     "Class.method" and take precedence when the first argument is an object
+     of that class. SwigRef, SwigGet, SwigSet, SwigMem, SwigStorage and throw
+     are built in. */
+  void define(const char *name, Function f);
+
+  /* Call a gateway function by ID. Arrays created during the call and not
+     reachable from the outputs are freed when the call returns, the outputs
+     are owned by the caller. Throws Error if the gateway raises an error. */
+  void call(Gateway gw, int fcn_id, int nlhs, mxArray *plhs[], int nrhs, mxArray *prhs[]);
+
+  /* Run the functions registered with mexAtExit, as "clear mex" would.
+     Fails if the MEX file is locked. */
+  void clear_mex();
+
+  /* Output of mexPrintf is written to stdout unless discarded */
+  void discard_output(bool flag);
+
+  const Stats &stats();
+  void reset_stats();
+
+  /* Create an object of a MATLAB class (handle semantics), e.g. to pass as
+     'self' to a director constructor */
+  mxArray *create_object(const char *classname);
+
+  /* Convenience conversions for test drivers */
+  mxArray *scalar(double value);
+  mxArray *string(const char *str);
+  double to_double(const mxArray *pm);
+  std::string to_string(const mxArray *pm);
+
+  /* A generated module, with its functions looked up by name */
+  class Module {
+  public:
+    explicit Module(Gateway gw);
+    /* Function ID of a wrapped function, e.g. "gcd", "new_Foo" or "Foo_bar" */
+    int id(const char *name);
+    void call(const char *name, int nlhs, mxArray *plhs[], int nrhs, mxArray *prhs[]);
+    /* Calls with a single output (possibly none), arguments are not freed */
+    mxArray *call(const char *name);
+    mxArray *call(const char *name, mxArray *a0);
+    mxArray *call(const char *name, mxArray *a0, mxArray *a1);
+    mxArray *call(const char *name, mxArray *a0, mxArray *a1, mxArray *a2);
+  private:
+    Gateway gw_;
+    std::map<std::string, int> ids_;
+  };
+}
+
+#endif
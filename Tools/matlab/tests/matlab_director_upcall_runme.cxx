@@ -0,0 +1,46 @@
+#include "mexstub.h"
+
+#include <stdio.h>
+
+extern "C" void mexFunction(int resc, mxArray *resv[], int argc, const mxArray *argv[]);
+
+/* eval method of the MATLAB subclass, matlab_director_upcall_helper.m */
+static int helper_eval(int, mxArray *plhs[], int, mxArray *prhs[]) {
+  plhs[0] = mxCreateDoubleScalar(2 * mxGetScalar(prhs[1]));
+  return 0;
+}
+
+static int integrate(mexstub::Module &m, mxArray *cb, double expected) {
+  mxArray *n = mexstub::scalar(100);
+  mxArray *r = m.call("integrate", cb, n);
+  double v = mexstub::to_double(r);
+  mxDestroyArray(r);
+  mxDestroyArray(n);
+  if (v != expected) {
+    fprintf(stderr, "integrate returned %g, expected %g\n", v, expected);
+    return 0;
+  }
+  return 1;
+}
+
+int main() {
+  mexstub::define("matlab_director_upcall_helper.eval", helper_eval);
+  mexstub::Module m(mexFunction);
+
+  mxArray *zero = mexstub::scalar(0);
+  mxArray *cb = m.call("new_Callback", zero);
+  if (!integrate(m, cb, 4950)) return 1;
+
+  mxArray *self = mexstub::create_object("matlab_director_upcall_helper");
+  mxArray *sub = m.call("new_Callback", self);
+  for (int i = 0; i < 2; ++i) {
+    mexstub::reset_stats();
+    if (!integrate(m, sub, 9900)) return 1;
+    // One interpreter call per upcall, plus converting the argument
+    if (mexstub::stats().interp_calls > 101) {
+      fprintf(stderr, "%lu interpreter calls for 100 upcalls\n", mexstub::stats().interp_calls);
+      return 1;
+    }
+  }
+  return 0;
+}
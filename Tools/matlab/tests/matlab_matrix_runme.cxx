@@ -0,0 +1,90 @@
+#include "mexstub.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+extern "C" void mexFunction(int resc, mxArray *resv[], int argc, const mxArray *argv[]);
+
+static void check(bool ok, const char *what) {
+  if (!ok) {
+    fprintf(stderr, "%s failed\n", what);
+    exit(1);
+  }
+}
+
+static double value(mxArray *pm) {
+  double v = mexstub::to_double(pm);
+  mxDestroyArray(pm);
+  return v;
+}
+
+int main() {
+  mexstub::Module m(mexFunction);
+  mxArray *d2 = mexstub::scalar(2), *d3 = mexstub::scalar(3), *d4 = mexstub::scalar(4);
+  mxArray *d1 = mexstub::scalar(1), *d0 = mexstub::scalar(0);
+
+  mxArray *r = m.call("make_matrix", d3, d4);
+  check(mxIsDouble(r) && mxGetM(r) == 3 && mxGetN(r) == 4, "make_matrix size");
+  check(mxGetPr(r)[2 + 3*3] == 23 && mxGetPr(r)[1] == 10, "make_matrix layout");
+  mxArray *args[3] = {r, d2, d3};
+  mxArray *e = 0;
+  m.call("element", 1, &e, 3, args);
+  check(value(e) == 23, "element");
+  mxDestroyArray(r);
+
+  mxArray *rows = mexstub::scalar(200), *cols = mexstub::scalar(100);
+  r = m.call("make_int_matrix", rows, cols);
+  check(mxGetClassID(r) == mxINT32_CLASS && ((int32_T *)mxGetData(r))[199 + 99*200] == 2089, "make_int_matrix");
+  args[0] = r;
+  args[1] = mexstub::scalar(150);
+  args[2] = mexstub::scalar(70);
+  m.call("int_element", 1, &e, 3, args);
+  check(value(e) == 1570, "int_element");
+  mxDestroyArray(r);
+
+  // [1, 2; 3, 4] as double, element (1,0)
+  mxArray *a = mxCreateDoubleMatrix(2, 2, mxREAL);
+  double *p = mxGetPr(a);
+  p[0] = 1; p[1] = 3; p[2] = 2; p[3] = 4;
+  args[0] = a; args[1] = d1; args[2] = d0;
+  m.call("int_element", 1, &e, 3, args);
+  check(value(e) == 3, "int_element(double)");
+  mxDestroyArray(a);
+
+  // Doubles converted to long long, 2^62 fits, 2^63 is out of range
+  a = mxCreateDoubleMatrix(1, 1, mxREAL);
+  mxGetPr(a)[0] = 4611686018427387904.0;
+  args[0] = a; args[1] = d0; args[2] = d0;
+  m.call("longlong_element", 1, &e, 3, args);
+  check(value(e) == 4611686018427387904.0, "longlong_element(2^62)");
+  mxGetPr(a)[0] = 9223372036854775808.0;
+  bool rejected = false;
+  try {
+    m.call("longlong_element", 1, &e, 3, args);
+    mxDestroyArray(e);
+  } catch (mexstub::Error &) {
+    rejected = true;
+  }
+  check(rejected, "longlong_element(2^63) rejected");
+  mxDestroyArray(a);
+
+  r = m.call("make_ragged");
+  check(mxIsCell(r), "make_ragged");
+  mxDestroyArray(r);
+
+  // [1, 2, 3; 4, 5, 6]
+  a = mxCreateDoubleMatrix(2, 3, mxREAL);
+  p = mxGetPr(a);
+  p[0] = 1; p[1] = 4; p[2] = 2; p[3] = 5; p[4] = 3; p[5] = 6;
+  args[0] = a; args[1] = d1; args[2] = d2;
+  m.call("colmajor_element", 1, &e, 3, args);
+  check(value(e) == 6, "colmajor_element");
+  m.call("rowmajor_element", 1, &e, 3, args);
+  check(value(e) == 6, "rowmajor_element");
+  mxDestroyArray(a);
+
+  r = m.call("matrix_view");
+  check(mxGetM(r) == 3 && mxGetN(r) == 4 && mxGetPr(r)[1 + 2*3] == 12, "matrix_view");
+  mxDestroyArray(r);
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include "mexstub.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+extern "C" void mexFunction(int resc, mxArray *resv[], int argc, const mxArray *argv[]);
+
+static void check(mexstub::Module &m, const char *name, mxArray *a0, mxArray *a1, int expected) {
+  mxArray *r = a1 ? m.call(name, a0, a1) : m.call(name, a0);
+  int v = (int)mexstub::to_double(r);
+  mxDestroyArray(r);
+  if (v != expected) {
+    fprintf(stderr, "%s returned %d, expected %d\n", name, v, expected);
+    exit(1);
+  }
+}
+
+int main() {
+  mexstub::Module m(mexFunction);
+  mxArray *f = m.call("new_Foo");
+  mxArray *b = m.call("new_Bar");
+  mxArray *s = m.call("new_Spam");
+  mxArray *k = m.call("new_Klass");
+  mxArray *i3 = mxCreateNumericMatrix(1, 1, mxINT32_CLASS, mxREAL);
+  *(int32_T *)mxGetData(i3) = 3;
+  mxArray *d3 = mexstub::scalar(3);
+  mxArray *d35 = mexstub::scalar(3.5);
+  mxArray *d2 = mexstub::scalar(2);
+  mxArray *d25 = mexstub::scalar(2.5);
+  mxArray *str = mexstub::string("hello");
+  mxArray *d5 = mexstub::scalar(5);
+  mxArray *dbig = mexstub::scalar(100000);
+  mxArray *dneg = mexstub::scalar(-5);
+  mxArray *i5 = mxCreateNumericMatrix(1, 1, mxINT16_CLASS, mxREAL);
+  *(int16_T *)mxGetData(i5) = 5;
+  mxArray *other = mexstub::create_object("containers.Map");
+
+  // Repeat so that the second round goes through the cached overloads
+  unsigned long calls[2];
+  for (int i = 0; i < 2; ++i) {
+    mexstub::reset_stats();
+    check(m, "over", f, 0, 1);
+    check(m, "over", b, 0, 2);
+    check(m, "over", s, 0, 3);
+    check(m, "over", i3, 0, 4);
+    check(m, "over", d3, 0, 4);
+    check(m, "over", d35, 0, 5);
+    check(m, "over", str, 0, 6);
+    check(m, "over", f, d2, 7);
+    check(m, "over", b, d25, 8);
+    check(m, "Klass_method", k, d2, 10);
+    check(m, "Klass_method", k, d25, 11);
+    check(m, "Klass_method", k, b, 12);
+    // Same classes, the cached overload must not be reused out of its range
+    check(m, "range", d5, 0, 20);
+    check(m, "range", dbig, 0, 21);
+    check(m, "range", d5, 0, 20);
+    check(m, "sign", d5, 0, 22);
+    check(m, "sign", dneg, 0, 23);
+    check(m, "sign", i5, 0, 22);
+    check(m, "sign", d5, 0, 22);
+    calls[i] = mexstub::stats().interp_calls;
+  }
+
+  // An object of a class not wrapped by SWIG matches no overload
+  try {
+    mxArray *r = m.call("over", other);
+    mxDestroyArray(r);
+    fprintf(stderr, "over accepted an object of another class\n");
+    return 1;
+  } catch (mexstub::Error &) {
+  }
+
+  // Cached dispatch skips the typechecks and their SwigGet calls
+  if (calls[1] >= calls[0]) {
+    fprintf(stderr, "dispatch cache not used: %lu interpreter calls, then %lu\n", calls[0], calls[1]);
+    return 1;
+  }
+  return 0;
+}